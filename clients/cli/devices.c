@@ -438,6 +438,60 @@ const NmcMetaGenericInfo *const
 
 /*****************************************************************************/
 
+static gconstpointer _metagen_device_detail_timing_get_fcn(NMC_META_GENERIC_INFO_GET_FCN_ARGS)
+{
+    NMDevice *   d = target;
+    GVariant *   timeline;
+    GVariantIter iter;
+    const char * event;
+    guint64      msec;
+    char **      arr = NULL;
+    guint        i;
+
+    NMC_HANDLE_COLOR(NM_META_COLOR_NONE);
+
+    switch (info->info_type) {
+    case NMC_GENERIC_INFO_TYPE_DEVICE_DETAIL_TIMING_ACTIVATION:
+        if (!NM_FLAGS_HAS(get_flags, NM_META_ACCESSOR_GET_FLAGS_ACCEPT_STRV))
+            return NULL;
+
+        timeline = nm_device_get_activation_timeline(d);
+        if (!timeline || g_variant_n_children(timeline) == 0)
+            goto arr_out;
+
+        arr = g_new(char *, g_variant_n_children(timeline) + 1);
+        i   = 0;
+        g_variant_iter_init(&iter, timeline);
+        while (g_variant_iter_next(&iter, "(&st)", &event, &msec))
+            arr[i++] = g_strdup_printf("+%" G_GUINT64_FORMAT " ms %s", msec, event);
+        arr[i] = NULL;
+        goto arr_out;
+
+    default:
+        break;
+    }
+
+    g_return_val_if_reached(NULL);
+
+arr_out:
+    NM_SET_OUT(out_is_default, !arr || !arr[0]);
+    *out_flags |= NM_META_ACCESSOR_GET_OUT_FLAGS_STRV;
+    *out_to_free = arr;
+    return arr;
+}
+
+const NmcMetaGenericInfo
+    *const metagen_device_detail_timing[_NMC_GENERIC_INFO_TYPE_DEVICE_DETAIL_TIMING_NUM + 1] = {
+#define _METAGEN_DEVICE_DETAIL_TIMING(type, name) \
+    [type] = NMC_META_GENERIC(name,                \
+                              .info_type = type,   \
+                              .get_fcn   = _metagen_device_detail_timing_get_fcn)
+        _METAGEN_DEVICE_DETAIL_TIMING(NMC_GENERIC_INFO_TYPE_DEVICE_DETAIL_TIMING_ACTIVATION,
+                                      "ACTIVATION"),
+};
+
+/*****************************************************************************/
+
 static gconstpointer _metagen_device_detail_capabilities_get_fcn(NMC_META_GENERIC_INFO_GET_FCN_ARGS)
 {
     NMDevice *           d = target;
@@ -784,6 +838,7 @@ const NmcMetaGenericInfo *const nmc_fields_dev_show_sections[] = {
     NMC_META_GENERIC_WITH_NESTED("VLAN", nmc_fields_dev_show_vlan_prop + 1),        /* 15 */
     NMC_META_GENERIC_WITH_NESTED("BLUETOOTH", nmc_fields_dev_show_bluetooth + 1),   /* 16 */
     NMC_META_GENERIC_WITH_NESTED("CONNECTIONS", metagen_device_detail_connections), /* 17 */
+    NMC_META_GENERIC_WITH_NESTED("TIMING", metagen_device_detail_timing),           /* 18 */
     NULL,
 };
 #define NMC_FIELDS_DEV_SHOW_SECTIONS_COMMON                                 \
@@ -822,7 +877,7 @@ usage(void)
                  "COMMAND := { status | show | set | connect | reapply | modify | disconnect | "
                  "delete | monitor | wifi | lldp }\n\n"
                  "  status\n\n"
-                 "  show [<ifname>]\n\n"
+                 "  show [--timing] [<ifname>]\n\n"
                  "  set [ifname] <ifname> [autoconnect yes|no] [managed yes|no]\n\n"
                  "  connect <ifname>\n\n"
                  "  reapply <ifname>\n\n"
@@ -863,10 +918,11 @@ usage_device_show(void)
 {
     g_printerr(_("Usage: nmcli device show { ARGUMENTS | help }\n"
                  "\n"
-                 "ARGUMENTS := [<ifname>]\n"
+                 "ARGUMENTS := [--timing] [<ifname>]\n"
                  "\n"
                  "Show details of device(s).\n"
-                 "The command lists details for all devices, or for a given device.\n\n"));
+                 "The command lists details for all devices, or for a given device.\n"
+                 "With --timing, also show the timeline of the last activation.\n\n"));
 }
 
 static void
@@ -1511,7 +1567,7 @@ print_team_info(NMDevice *device, NmCli *nmc, const char *group_prefix, const ch
 }
 
 static gboolean
-show_device_info(NMDevice *device, NmCli *nmc)
+show_device_info(NMDevice *device, NmCli *nmc, gboolean show_timing)
 {
     GError *                         error = NULL;
     NMDeviceState                    state = NM_DEVICE_STATE_UNKNOWN;
@@ -1525,6 +1581,7 @@ show_device_info(NMDevice *device, NmCli *nmc)
     NMDhcpConfig *                   dhcp4, *dhcp6;
     const char *                     base_hdr          = _("Device details");
     GPtrArray *                      fields_in_section = NULL;
+    gs_free char *                   fields_str_free   = NULL;
 
     if (!nmc->required_fields || g_ascii_strcasecmp(nmc->required_fields, "common") == 0)
         fields_str = NMC_FIELDS_DEV_SHOW_SECTIONS_COMMON;
@@ -1533,6 +1590,9 @@ show_device_info(NMDevice *device, NmCli *nmc)
     } else
         fields_str = nmc->required_fields;
 
+    if (show_timing && fields_str)
+        fields_str = fields_str_free = g_strconcat(fields_str, ",TIMING", NULL);
+
     sections_array =
         parse_output_fields(fields_str,
                             (const NMMetaAbstractInfo *const *) nmc_fields_dev_show_sections,
@@ -1852,6 +1912,26 @@ show_device_info(NMDevice *device, NmCli *nmc)
             was_output = TRUE;
             continue;
         }
+
+        if (nmc_fields_dev_show_sections[section_idx]->nested == metagen_device_detail_timing) {
+            gs_free char *f = NULL;
+
+            /* "-f all" only includes the timing with --timing. */
+            if (!fields_str && !show_timing)
+                continue;
+
+            f = section_fld ? g_strdup_printf("TIMING.%s", section_fld) : NULL;
+
+            nmc_print(&nmc->nmc_config,
+                      (gpointer[]){device, NULL},
+                      NULL,
+                      NULL,
+                      NMC_META_GENERIC_GROUP("TIMING", metagen_device_detail_timing, N_("NAME")),
+                      f,
+                      NULL);
+            was_output = TRUE;
+            continue;
+        }
     }
 
     if (sections_array)
@@ -1934,9 +2014,13 @@ do_devices_status(const NMCCommand *cmd, NmCli *nmc, int argc, const char *const
 static void
 do_device_show(const NMCCommand *cmd, NmCli *nmc, int argc, const char *const *argv)
 {
-    gs_free_error GError *error = NULL;
+    gs_free_error GError *error       = NULL;
+    gboolean              show_timing = FALSE;
+
+    /* check device show options [--timing] */
+    while (next_arg(nmc, &argc, &argv, "--timing", NULL) > 0)
+        show_timing = TRUE;
 
-    next_arg(nmc, &argc, &argv, NULL);
     if (!nmc->mode_specified)
         nmc->nmc_config_mutable.multiline_output =
             TRUE; /* multiline mode is default for 'device show' */
@@ -1960,7 +2044,7 @@ do_device_show(const NMCCommand *cmd, NmCli *nmc, int argc, const char *const *a
         if (nmc->complete)
             return;
 
-        show_device_info(device, nmc);
+        show_device_info(device, nmc, show_timing);
     } else {
         NMDevice **devices = nmc_get_devices_sorted(nmc->client);
         int        i;
@@ -1970,7 +2054,7 @@ do_device_show(const NMCCommand *cmd, NmCli *nmc, int argc, const char *const *a
 
         /* Show details for all devices */
         for (i = 0; devices[i]; i++) {
-            if (!show_device_info(devices[i], nmc))
+            if (!show_device_info(devices[i], nmc, show_timing))
                 break;
             if (devices[i + 1])
                 g_print("\n"); /* Empty line */
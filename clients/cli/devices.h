@@ -21,6 +21,7 @@ NMMetaColor nmc_device_state_to_color(NMDevice *device);
 extern const NmcMetaGenericInfo *const metagen_device_status[];
 extern const NmcMetaGenericInfo *const metagen_device_detail_general[];
 extern const NmcMetaGenericInfo *const metagen_device_detail_connections[];
+extern const NmcMetaGenericInfo *const metagen_device_detail_timing[];
 extern const NmcMetaGenericInfo *const metagen_device_detail_capabilities[];
 extern const NmcMetaGenericInfo *const metagen_device_detail_wired_properties[];
 extern const NmcMetaGenericInfo *const metagen_device_detail_wifi_properties[];
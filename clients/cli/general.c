@@ -286,11 +286,12 @@ static void
 usage_general(void)
 {
     g_printerr(_("Usage: nmcli general { COMMAND | help }\n\n"
-                 "COMMAND := { status | hostname | permissions | logging }\n\n"
+                 "COMMAND := { status | hostname | permissions | logging | stats }\n\n"
                  "  status\n\n"
                  "  hostname [<hostname>]\n\n"
                  "  permissions\n\n"
-                 "  logging [level <log level>] [domains <log domains>]\n\n"));
+                 "  logging [level <log level>] [domains <log domains>]\n\n"
+                 "  stats\n\n"));
 }
 
 static void
@@ -324,6 +325,15 @@ usage_general_permissions(void)
                  "Show caller permissions for authenticated operations.\n\n"));
 }
 
+static void
+usage_general_stats(void)
+{
+    g_printerr(_("Usage: nmcli general stats { help }\n"
+                 "\n"
+                 "Show statistics about the netlink messages handled by NetworkManager\n"
+                 "and about how long its idle handlers wait to run.\n\n"));
+}
+
 static void
 usage_general_reload(void)
 {
@@ -859,6 +869,146 @@ do_general_logging(const NMCCommand *cmd, NmCli *nmc, int argc, const char *cons
     }
 }
 
+static void
+_print_stats_histogram(GVariant *stats, const char *key, const char *title)
+{
+    static const char *const bucket_names[] =
+        {"<10us", "<100us", "<1ms", "<10ms", "<100ms", "<1s", ">=1s"};
+    gs_unref_variant GVariant *v_buckets = NULL;
+    const guint64 *            buckets;
+    gsize                      n_buckets;
+    guint64                    count;
+    guint64                    sum_usec;
+    guint64                    max_usec;
+    gsize                      i;
+
+    if (!g_variant_lookup(stats, key, "(ttt@at)", &count, &sum_usec, &max_usec, &v_buckets))
+        return;
+
+    g_print(_("%s: %" G_GUINT64_FORMAT " samples, average %" G_GUINT64_FORMAT
+              " us, maximum %" G_GUINT64_FORMAT " us\n"),
+            title,
+            count,
+            count > 0 ? sum_usec / count : (guint64) 0,
+            max_usec);
+
+    buckets = g_variant_get_fixed_array(v_buckets, &n_buckets, sizeof(guint64));
+    for (i = 0; i < n_buckets; i++) {
+        g_print("  %-8s %" G_GUINT64_FORMAT "\n",
+                i < G_N_ELEMENTS(bucket_names) ? bucket_names[i] : "?",
+                buckets[i]);
+    }
+}
+
+static void
+_get_stats_cb(GObject *object, GAsyncResult *result, gpointer user_data)
+{
+    NmCli *          nmc             = user_data;
+    gs_unref_variant GVariant *res   = NULL;
+    gs_unref_variant GVariant *stats = NULL;
+    gs_unref_variant GVariant *msgs  = NULL;
+    gs_free_error GError *error      = NULL;
+    GVariantIter          iter;
+    const char *          type_str;
+    gint32                ifindex;
+    guint64               val;
+
+    res = nm_client_dbus_call_finish(NM_CLIENT(object), result, &error);
+    if (!res) {
+        g_dbus_error_strip_remote_error(error);
+        g_string_printf(nmc->return_text,
+                        _("Error: failed to get statistics: %s"),
+                        nmc_error_get_simple_message(error));
+        nmc->return_value = NMC_RESULT_ERROR_UNKNOWN;
+        quit();
+        return;
+    }
+
+    g_variant_get(res, "(@a{sv})", &stats);
+
+    msgs = g_variant_lookup_value(stats, "messages", G_VARIANT_TYPE("a{st}"));
+    if (msgs) {
+        g_print(_("Netlink messages by type:\n"));
+        g_variant_iter_init(&iter, msgs);
+        while (g_variant_iter_next(&iter, "{&st}", &type_str, &val))
+            g_print("  %-16s %" G_GUINT64_FORMAT "\n", type_str, val);
+        nm_clear_pointer(&msgs, g_variant_unref);
+    }
+
+    msgs = g_variant_lookup_value(stats, "messages-by-ifindex", G_VARIANT_TYPE("a{it}"));
+    if (msgs) {
+        g_print(_("Netlink messages by interface index:\n"));
+        g_variant_iter_init(&iter, msgs);
+        while (g_variant_iter_next(&iter, "{it}", &ifindex, &val))
+            g_print("  %-16d %" G_GUINT64_FORMAT "\n", (int) ifindex, val);
+        nm_clear_pointer(&msgs, g_variant_unref);
+    }
+
+    _print_stats_histogram(stats, "parse", _("Parse time"));
+    _print_stats_histogram(stats, "cache-update", _("Cache update time"));
+    _print_stats_histogram(stats, "ack-wait", _("ACK wait time"));
+
+    if (g_variant_lookup(stats, "resyncs", "t", &val))
+        g_print(_("Resyncs: %" G_GUINT64_FORMAT "\n"), val);
+    if (g_variant_lookup(stats, "overflows", "t", &val))
+        g_print(_("Overflows: %" G_GUINT64_FORMAT "\n"), val);
+
+    msgs = g_variant_lookup_value(stats, "idle-classes", G_VARIANT_TYPE("a{s(uttt)}"));
+    if (msgs) {
+        guint32 n_pending;
+        guint64 n_dispatched;
+        guint64 wait_total_usec;
+        guint64 wait_max_usec;
+
+        g_print(_("Idle handlers by class:\n"));
+        g_variant_iter_init(&iter, msgs);
+        while (g_variant_iter_next(&iter,
+                                   "{&s(uttt)}",
+                                   &type_str,
+                                   &n_pending,
+                                   &n_dispatched,
+                                   &wait_total_usec,
+                                   &wait_max_usec)) {
+            g_print(_("  %-16s %u pending, %" G_GUINT64_FORMAT
+                      " dispatched, average wait %" G_GUINT64_FORMAT
+                      " us, maximum %" G_GUINT64_FORMAT " us\n"),
+                    type_str,
+                    (guint) n_pending,
+                    n_dispatched,
+                    n_dispatched > 0 ? wait_total_usec / n_dispatched : (guint64) 0,
+                    wait_max_usec);
+        }
+    }
+
+    quit();
+}
+
+static void
+do_general_stats(const NMCCommand *cmd, NmCli *nmc, int argc, const char *const *argv)
+{
+    next_arg(nmc, &argc, &argv, NULL);
+    if (nmc->complete)
+        return;
+
+    if (argc > 0) {
+        g_string_printf(nmc->return_text, _("Error: extra argument '%s'"), *argv);
+        nmc->return_value = NMC_RESULT_ERROR_USER_INPUT;
+        return;
+    }
+
+    nmc->should_wait++;
+    nm_client_dbus_call(nmc->client,
+                        NM_DBUS_PATH,
+                        NM_DBUS_INTERFACE,
+                        "GetPlatformStats",
+                        NULL,
+                        G_VARIANT_TYPE("(a{sv})"),
+                        -1,
+                        NULL,
+                        _get_stats_cb,
+                        nmc);
+}
+
 static void
 save_hostname_cb(GObject *object, GAsyncResult *result, gpointer user_data)
 {
@@ -909,6 +1059,7 @@ nmc_command_func_general(const NMCCommand *cmd, NmCli *nmc, int argc, const char
         {"hostname", do_general_hostname, usage_general_hostname, TRUE, TRUE},
         {"permissions", do_general_permissions, usage_general_permissions, TRUE, TRUE},
         {"logging", do_general_logging, usage_general_logging, TRUE, TRUE},
+        {"stats", do_general_stats, usage_general_stats, TRUE, TRUE},
         {"reload", do_general_reload, usage_general_reload, FALSE, FALSE},
         {NULL, do_general_status, usage_general, TRUE, TRUE},
     };
@@ -233,6 +233,9 @@ typedef enum {
     NMC_GENERIC_INFO_TYPE_DEVICE_DETAIL_INTERFACE_FLAGS_CARRIER,
     _NMC_GENERIC_INFO_TYPE_DEVICE_DETAIL_INTERFACE_FLAGS_NUM,
 
+    NMC_GENERIC_INFO_TYPE_DEVICE_DETAIL_TIMING_ACTIVATION = 0,
+    _NMC_GENERIC_INFO_TYPE_DEVICE_DETAIL_TIMING_NUM,
+
 } NmcGenericInfoType;
 
 #define NMC_HANDLE_COLOR(color)                          \
@@ -86,8 +86,9 @@ _provider_detect(GCancellable *sigterm_cancellable)
         NMCS_TYPE_PROVIDER_GCP,
         NMCS_TYPE_PROVIDER_AZURE,
     };
-    int    i;
-    gulong cancellable_signal_id;
+    const char *cache_dir;
+    int         i;
+    gulong      cancellable_signal_id;
 
     cancellable_signal_id = g_cancellable_connect(sigterm_cancellable,
                                                   G_CALLBACK(_provider_detect_sigterm_cb),
@@ -98,6 +99,16 @@ _provider_detect(GCancellable *sigterm_cancellable)
 
     http_client = nmcs_wait_for_objects_register(nm_http_client_new());
 
+    /* systemd sets $CACHE_DIRECTORY for "CacheDirectory=". Remember the responses
+     * there, so that the next run only needs to re-validate them. */
+    cache_dir = g_getenv(NMCS_ENV_VARIABLE("CACHE_DIRECTORY"));
+    if (cache_dir && cache_dir[0] == '/' && !strchr(cache_dir, ':')) {
+        gs_free char *filename = NULL;
+
+        filename = g_build_filename(cache_dir, "http-cache", NULL);
+        nm_http_client_cache_load(http_client, filename);
+    }
+
     for (i = 0; i < G_N_ELEMENTS(gtypes); i++) {
         NMCSProvider *provider;
 
@@ -360,153 +371,240 @@ _nmc_mangle_connection(NMDevice *                            device,
 
 /*****************************************************************************/
 
-static guint
-_config_data_get_num_valid(GHashTable *config_dict)
-{
+/* Reapply() for the individual devices is independent, so we configure several
+ * devices at the same time. Limit the number, to not flood NetworkManager with
+ * requests on instances with many interfaces. */
+#define CONFIG_MAX_PARALLEL 8
+
+typedef struct {
+    GMainLoop *   main_loop;
+    GCancellable *sigterm_cancellable;
+    GQueue        pending;
+    guint         n_running;
+    bool          any_changes : 1;
+} ConfigAllData;
+
+typedef struct {
+    ConfigAllData *                       all_data;
+    NMDevice *                            device;
+    const char *                          hwaddr;
     const NMCSProviderGetConfigIfaceData *config_data;
-    GHashTableIter                        h_iter;
-    guint                                 n = 0;
+    NMConnection *                        applied_connection;
+    guint64                               applied_version_id;
+    guint                                 try_count;
+} ConfigOneData;
 
-    g_hash_table_iter_init(&h_iter, config_dict);
-    while (g_hash_table_iter_next(&h_iter, NULL, (gpointer *) &config_data)) {
-        if (nmcs_provider_get_config_iface_data_is_valid(config_data))
-            n++;
-    }
+static void _config_one_get_applied_connection(ConfigOneData *data);
 
-    return n;
+static void
+_config_one_data_free(ConfigOneData *data)
+{
+    g_object_unref(data->device);
+    nm_g_object_unref(data->applied_connection);
+    nm_g_slice_free(data);
 }
 
-static gboolean
-_config_one(GCancellable *                        sigterm_cancellable,
-            NMClient *                            nmc,
-            gboolean                              is_single_nic,
-            const char *                          hwaddr,
-            const NMCSProviderGetConfigIfaceData *config_data)
+static void
+_config_all_start_next(ConfigAllData *all_data)
 {
-    gs_unref_object NMDevice *device                 = NULL;
-    gs_unref_object NMConnection *applied_connection = NULL;
-    guint64                       applied_version_id;
-    gs_free_error GError *error = NULL;
-    gboolean              changed;
-    gboolean              version_id_changed;
-    guint                 try_count;
-    gboolean              any_changes = FALSE;
+    ConfigOneData *data;
 
-    g_main_context_iteration(NULL, FALSE);
+    if (g_cancellable_is_cancelled(all_data->sigterm_cancellable)) {
+        while ((data = g_queue_pop_head(&all_data->pending)))
+            _config_one_data_free(data);
+    }
 
-    if (g_cancellable_is_cancelled(sigterm_cancellable))
-        return FALSE;
+    while (all_data->n_running < CONFIG_MAX_PARALLEL) {
+        data = g_queue_pop_head(&all_data->pending);
+        if (!data)
+            break;
 
-    device = nm_g_object_ref(_nmc_get_device_by_hwaddr(nmc, hwaddr));
-    if (!device) {
-        _LOGD("config device %s: skip because device not found", hwaddr);
-        return FALSE;
-    }
+        _LOGD("config device %s: configuring \"%s\" (%s)...",
+              data->hwaddr,
+              nm_device_get_iface(data->device) ?: "/unknown/",
+              nm_object_get_path(NM_OBJECT(data->device)));
 
-    if (!nmcs_provider_get_config_iface_data_is_valid(config_data)) {
-        _LOGD("config device %s: skip because meta data not successfully fetched", hwaddr);
-        return FALSE;
+        all_data->n_running++;
+        _config_one_get_applied_connection(data);
     }
 
-    _LOGD("config device %s: configuring \"%s\" (%s)...",
-          hwaddr,
-          nm_device_get_iface(device) ?: "/unknown/",
-          nm_object_get_path(NM_OBJECT(device)));
+    if (all_data->n_running == 0)
+        g_main_loop_quit(all_data->main_loop);
+}
+
+static void
+_config_one_done(ConfigOneData *data)
+{
+    ConfigAllData *all_data = data->all_data;
+
+    _config_one_data_free(data);
+
+    nm_assert(all_data->n_running > 0);
+    all_data->n_running--;
+    _config_all_start_next(all_data);
+}
 
-    try_count = 0;
+static void
+_config_one_reapply_cb(GObject *source, GAsyncResult *result, gpointer user_data)
+{
+    ConfigOneData *data         = user_data;
+    gs_free_error GError *error = NULL;
 
-try_again:
+    if (!nm_device_reapply_finish(NM_DEVICE(source), result, &error)) {
+        if (g_error_matches(error, NM_DEVICE_ERROR, NM_DEVICE_ERROR_VERSION_ID_MISMATCH)
+            && data->try_count < 5) {
+            _LOGD("config device %s: applied connection changed in the meantime. Retry...",
+                  data->hwaddr);
+            g_clear_object(&data->applied_connection);
+            data->try_count++;
+            _config_one_get_applied_connection(data);
+            return;
+        }
 
-    applied_connection = nmcs_device_get_applied_connection(device,
-                                                            sigterm_cancellable,
-                                                            &applied_version_id,
-                                                            &error);
-    if (!applied_connection) {
+        if (!nm_utils_error_is_cancelled(error)) {
+            _LOGD("config device %s: failure to reapply connection \"%s\" (%s): %s",
+                  data->hwaddr,
+                  nm_connection_get_id(data->applied_connection),
+                  nm_connection_get_uuid(data->applied_connection),
+                  error->message);
+        }
+    } else {
+        _LOGD("config device %s: connection \"%s\" (%s) reapplied",
+              data->hwaddr,
+              nm_connection_get_id(data->applied_connection),
+              nm_connection_get_uuid(data->applied_connection));
+    }
+
+    _config_one_done(data);
+}
+
+static void
+_config_one_get_applied_connection_cb(GObject *source, GAsyncResult *result, gpointer user_data)
+{
+    ConfigOneData *data         = user_data;
+    gs_free_error GError *error = NULL;
+    gboolean              changed;
+
+    data->applied_connection = nm_device_get_applied_connection_finish(NM_DEVICE(source),
+                                                                       result,
+                                                                       &data->applied_version_id,
+                                                                       &error);
+    if (!data->applied_connection) {
         if (!nm_utils_error_is_cancelled(error))
             _LOGD("config device %s: device has no applied connection (%s). Skip",
-                  hwaddr,
+                  data->hwaddr,
                   error->message);
-        return any_changes;
+        goto out_done;
     }
 
-    if (_nmc_skip_connection(applied_connection)) {
+    if (_nmc_skip_connection(data->applied_connection)) {
         _LOGD("config device %s: skip applied connection due to user data %s",
-              hwaddr,
+              data->hwaddr,
               USER_TAG_SKIP);
-        return any_changes;
+        goto out_done;
     }
 
-    if (!_nmc_mangle_connection(device, applied_connection, config_data, &changed)) {
-        _LOGD("config device %s: device has no suitable applied connection. Skip", hwaddr);
-        return any_changes;
+    if (!_nmc_mangle_connection(data->device,
+                                data->applied_connection,
+                                data->config_data,
+                                &changed)) {
+        _LOGD("config device %s: device has no suitable applied connection. Skip", data->hwaddr);
+        goto out_done;
     }
 
     if (!changed) {
         _LOGD("config device %s: device needs no update to applied connection \"%s\" (%s). Skip",
-              hwaddr,
-              nm_connection_get_id(applied_connection),
-              nm_connection_get_uuid(applied_connection));
-        return any_changes;
+              data->hwaddr,
+              nm_connection_get_id(data->applied_connection),
+              nm_connection_get_uuid(data->applied_connection));
+        goto out_done;
     }
 
     _LOGD("config device %s: reapply connection \"%s\" (%s)",
-          hwaddr,
-          nm_connection_get_id(applied_connection),
-          nm_connection_get_uuid(applied_connection));
+          data->hwaddr,
+          nm_connection_get_id(data->applied_connection),
+          nm_connection_get_uuid(data->applied_connection));
 
     /* we are about to call Reapply(). If if that fails, it counts as if we changed something. */
-    any_changes = TRUE;
-
-    if (!nmcs_device_reapply(device,
-                             sigterm_cancellable,
-                             applied_connection,
-                             applied_version_id,
-                             &version_id_changed,
-                             &error)) {
-        if (version_id_changed && try_count < 5) {
-            _LOGD("config device %s: applied connection changed in the meantime. Retry...", hwaddr);
-            g_clear_object(&applied_connection);
-            g_clear_error(&error);
-            try_count++;
-            goto try_again;
-        }
-
-        if (!nm_utils_error_is_cancelled(error)) {
-            _LOGD("config device %s: failure to reapply connection \"%s\" (%s): %s",
-                  hwaddr,
-                  nm_connection_get_id(applied_connection),
-                  nm_connection_get_uuid(applied_connection),
-                  error->message);
-        }
-        return any_changes;
-    }
-
-    _LOGD("config device %s: connection \"%s\" (%s) reapplied",
-          hwaddr,
-          nm_connection_get_id(applied_connection),
-          nm_connection_get_uuid(applied_connection));
+    data->all_data->any_changes = TRUE;
+
+    nm_device_reapply_async(data->device,
+                            data->applied_connection,
+                            data->applied_version_id,
+                            0,
+                            data->all_data->sigterm_cancellable,
+                            _config_one_reapply_cb,
+                            data);
+    return;
+
+out_done:
+    _config_one_done(data);
+}
 
-    return any_changes;
+static void
+_config_one_get_applied_connection(ConfigOneData *data)
+{
+    nm_device_get_applied_connection_async(data->device,
+                                           0,
+                                           data->all_data->sigterm_cancellable,
+                                           _config_one_get_applied_connection_cb,
+                                           data);
 }
 
 static gboolean
 _config_all(GCancellable *sigterm_cancellable, NMClient *nmc, GHashTable *config_dict)
 {
+    nm_auto_unref_gmainloop GMainLoop *main_loop = g_main_loop_new(NULL, FALSE);
+    ConfigAllData                      all_data  = {
+        .main_loop           = main_loop,
+        .sigterm_cancellable = sigterm_cancellable,
+        .pending             = G_QUEUE_INIT,
+    };
     GHashTableIter                        h_iter;
     const NMCSProviderGetConfigIfaceData *c_config_data;
     const char *                          c_hwaddr;
-    gboolean                              is_single_nic;
-    gboolean                              any_changes = FALSE;
 
-    is_single_nic = (_config_data_get_num_valid(config_dict) <= 1);
+    if (g_cancellable_is_cancelled(sigterm_cancellable))
+        return FALSE;
 
     g_hash_table_iter_init(&h_iter, config_dict);
     while (g_hash_table_iter_next(&h_iter, (gpointer *) &c_hwaddr, (gpointer *) &c_config_data)) {
-        if (_config_one(sigterm_cancellable, nmc, is_single_nic, c_hwaddr, c_config_data))
-            any_changes = TRUE;
+        ConfigOneData *data;
+        NMDevice *     device;
+
+        device = _nmc_get_device_by_hwaddr(nmc, c_hwaddr);
+        if (!device) {
+            _LOGD("config device %s: skip because device not found", c_hwaddr);
+            continue;
+        }
+
+        if (!nmcs_provider_get_config_iface_data_is_valid(c_config_data)) {
+            _LOGD("config device %s: skip because meta data not successfully fetched", c_hwaddr);
+            continue;
+        }
+
+        data  = g_slice_new(ConfigOneData);
+        *data = (ConfigOneData){
+            .all_data    = &all_data,
+            .device      = g_object_ref(device),
+            .hwaddr      = c_hwaddr,
+            .config_data = c_config_data,
+        };
+        g_queue_push_tail(&all_data.pending, data);
     }
 
-    return any_changes;
+    if (g_queue_is_empty(&all_data.pending))
+        return FALSE;
+
+    /* All requests get cancelled on SIGTERM and still complete via their callbacks.
+     * We only return after the last one finished. */
+    _config_all_start_next(&all_data);
+    g_main_loop_run(main_loop);
+
+    nm_assert(all_data.n_running == 0);
+    nm_assert(g_queue_is_empty(&all_data.pending));
+
+    return all_data.any_changes;
 }
 
 /*****************************************************************************/
@@ -583,6 +681,8 @@ main(int argc, const char *const *argv)
     if (!config_dict)
         goto done;
 
+    nm_http_client_cache_save(nmcs_provider_get_http_client(provider));
+
     if (_config_all(sigterm_cancellable, nmc, config_dict))
         _LOGI("some changes were applied for provider %s", nmcs_provider_get_name(provider));
     else
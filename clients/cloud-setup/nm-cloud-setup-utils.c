@@ -561,6 +561,56 @@ nmcs_utils_parse_get_full_line(GBytes *mem, const char *needle)
 
 /*****************************************************************************/
 
+/**
+ * nmcs_utils_base_uri_get:
+ * @p_base_cached: the location where the result is cached.
+ * @env_name: the name of the environment variable that overrides the host.
+ * @default_base: the base URI (scheme and host) if the environment variable is
+ *   not set.
+ * @path: (allow-none): a path that gets appended to the base URI.
+ *
+ * The host of the meta data service can be set via environment variable.
+ * This is mainly for testing (for example, against a local HTTP server), it's
+ * not usually supposed to be configured. Consider this private API!
+ *
+ * Returns: the interned base URI, without trailing slash.
+ */
+const char *
+nmcs_utils_base_uri_get(const char **p_base_cached,
+                        const char * env_name,
+                        const char * default_base,
+                        const char * path)
+{
+    const char *base;
+
+again:
+    base = g_atomic_pointer_get(p_base_cached);
+    if (G_UNLIKELY(!base)) {
+        gs_free char *s1 = NULL;
+        gs_free char *s2 = NULL;
+
+        base = g_getenv(env_name);
+        if (!base || !base[0])
+            base = default_base;
+        else if (!strchr(base, '/')) {
+            /* only a host name (and port) given. */
+            base = (s1 = g_strconcat("http://", base, NULL));
+        }
+
+        if (path)
+            base = (s2 = g_strconcat(base, path, NULL));
+
+        base = g_intern_string(base);
+
+        nm_assert(!NM_STR_HAS_SUFFIX(base, "/"));
+
+        if (!g_atomic_pointer_compare_and_exchange(p_base_cached, NULL, base))
+            goto again;
+    }
+
+    return base;
+}
+
 char *
 nmcs_utils_uri_build_concat_v(const char *base, const char **components, gsize n_components)
 {
@@ -730,100 +780,3 @@ nmcs_setting_ip_replace_ipv4_rules(NMSettingIPConfig *s_ip,
 
     return any_changes;
 }
-
-/*****************************************************************************/
-
-typedef struct {
-    GMainLoop *   main_loop;
-    NMConnection *connection;
-    GError *      error;
-    guint64       version_id;
-} DeviceGetAppliedConnectionData;
-
-static void
-_nmcs_device_get_applied_connection_cb(GObject *source, GAsyncResult *result, gpointer user_data)
-{
-    DeviceGetAppliedConnectionData *data = user_data;
-
-    data->connection = nm_device_get_applied_connection_finish(NM_DEVICE(source),
-                                                               result,
-                                                               &data->version_id,
-                                                               &data->error);
-    g_main_loop_quit(data->main_loop);
-}
-
-NMConnection *
-nmcs_device_get_applied_connection(NMDevice *    device,
-                                   GCancellable *cancellable,
-                                   guint64 *     version_id,
-                                   GError **     error)
-{
-    nm_auto_unref_gmainloop GMainLoop *main_loop = g_main_loop_new(NULL, FALSE);
-    DeviceGetAppliedConnectionData     data      = {
-        .main_loop = main_loop,
-    };
-
-    nm_device_get_applied_connection_async(device,
-                                           0,
-                                           cancellable,
-                                           _nmcs_device_get_applied_connection_cb,
-                                           &data);
-
-    g_main_loop_run(main_loop);
-
-    if (data.error)
-        g_propagate_error(error, data.error);
-    NM_SET_OUT(version_id, data.version_id);
-    return data.connection;
-}
-
-/*****************************************************************************/
-
-typedef struct {
-    GMainLoop *main_loop;
-    GError *   error;
-} DeviceReapplyData;
-
-static void
-_nmcs_device_reapply_cb(GObject *source, GAsyncResult *result, gpointer user_data)
-{
-    DeviceReapplyData *data = user_data;
-
-    nm_device_reapply_finish(NM_DEVICE(source), result, &data->error);
-    g_main_loop_quit(data->main_loop);
-}
-
-gboolean
-nmcs_device_reapply(NMDevice *    device,
-                    GCancellable *sigterm_cancellable,
-                    NMConnection *connection,
-                    guint64       version_id,
-                    gboolean *    out_version_id_changed,
-                    GError **     error)
-{
-    nm_auto_unref_gmainloop GMainLoop *main_loop = g_main_loop_new(NULL, FALSE);
-    DeviceReapplyData                  data      = {
-        .main_loop = main_loop,
-    };
-
-    nm_device_reapply_async(device,
-                            connection,
-                            version_id,
-                            0,
-                            sigterm_cancellable,
-                            _nmcs_device_reapply_cb,
-                            &data);
-
-    g_main_loop_run(main_loop);
-
-    if (data.error) {
-        NM_SET_OUT(
-            out_version_id_changed,
-            g_error_matches(data.error, NM_DEVICE_ERROR, NM_DEVICE_ERROR_VERSION_ID_MISMATCH));
-        g_propagate_error(error, data.error);
-        return FALSE;
-    }
-
-    NM_SET_OUT(out_version_id_changed, FALSE);
-    return TRUE;
-}
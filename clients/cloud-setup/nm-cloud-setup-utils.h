@@ -86,6 +86,11 @@ const char *nmcs_utils_parse_get_full_line(GBytes *mem, const char *needle);
 
 /*****************************************************************************/
 
+const char *nmcs_utils_base_uri_get(const char **p_base_cached,
+                                    const char * env_name,
+                                    const char * default_base,
+                                    const char * path);
+
 char *nmcs_utils_uri_build_concat_v(const char *base, const char **components, gsize n_components);
 
 #define nmcs_utils_uri_build_concat(base, ...) \
@@ -105,18 +110,4 @@ gboolean nmcs_setting_ip_replace_ipv4_rules(NMSettingIPConfig *s_ip,
                                             NMIPRoutingRule ** entries_arr,
                                             guint              entries_len);
 
-/*****************************************************************************/
-
-NMConnection *nmcs_device_get_applied_connection(NMDevice *    device,
-                                                 GCancellable *cancellable,
-                                                 guint64 *     version_id,
-                                                 GError **     error);
-
-gboolean nmcs_device_reapply(NMDevice *    device,
-                             GCancellable *sigterm_cancellable,
-                             NMConnection *connection,
-                             guint64       version_id,
-                             gboolean *    out_version_id_changed,
-                             GError **     error);
-
 #endif /* __NM_CLOUD_SETUP_UTILS_H__ */
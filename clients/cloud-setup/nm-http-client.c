@@ -8,9 +8,12 @@
 
 #include "nm-cloud-setup-utils.h"
 #include "nm-glib-aux/nm-str-buf.h"
+#include "nm-glib-aux/nm-io-utils.h"
 
 #define NM_CURL_DEBUG 0
 
+#define MAX_HOST_CONNECTIONS 8
+
 /*****************************************************************************/
 
 typedef struct {
@@ -18,6 +21,9 @@ typedef struct {
     CURLM *       mhandle;
     GSource *     mhandle_source_timeout;
     GHashTable *  source_sockets_hashtable;
+    GHashTable *  cache;
+    char *        cache_filename;
+    bool          cache_dirty : 1;
 } NMHttpClientPrivate;
 
 struct _NMHttpClient {
@@ -112,12 +118,204 @@ _get_result_free(gpointer data)
     nm_g_slice_free(get_result);
 }
 
+typedef struct {
+    char *  etag;
+    GBytes *data;
+
+    /* whether the URL was requested since the cache was loaded. Entries
+     * that were not get dropped when saving the cache. */
+    bool used : 1;
+} CacheEntry;
+
+static void
+_cache_entry_free(gpointer data)
+{
+    CacheEntry *entry = data;
+
+    g_free(entry->etag);
+    g_bytes_unref(entry->data);
+    nm_g_slice_free(entry);
+}
+
+static void
+_cache_entry_set(NMHttpClient *self, const char *url, const char *etag, GBytes *data)
+{
+    NMHttpClientPrivate *priv = NM_HTTP_CLIENT_GET_PRIVATE(self);
+    CacheEntry *         entry;
+
+    entry = g_hash_table_lookup(priv->cache, url);
+    if (!etag) {
+        if (entry) {
+            g_hash_table_remove(priv->cache, url);
+            priv->cache_dirty = TRUE;
+        }
+        return;
+    }
+
+    if (entry && nm_streq(entry->etag, etag) && g_bytes_equal(entry->data, data))
+        return;
+
+    entry  = g_slice_new(CacheEntry);
+    *entry = (CacheEntry){
+        .etag = g_strdup(etag),
+        .data = g_bytes_ref(data),
+        .used = TRUE,
+    };
+    g_hash_table_insert(priv->cache, g_strdup(url), entry);
+    priv->cache_dirty = TRUE;
+}
+
+static char *
+_cache_group_name(const char *url)
+{
+    /* URLs may contain characters that are not valid in a group name (like the
+     * brackets of an IPv6 address). Use a hash instead, and keep the URL as value. */
+    return g_compute_checksum_for_string(G_CHECKSUM_SHA256, url, -1);
+}
+
+/**
+ * nm_http_client_cache_load:
+ * @self: the #NMHttpClient instance
+ * @filename: the file with the persisted response cache.
+ *
+ * Enables caching of responses that carry an ETag header. For URLs that
+ * are in the cache, requests are sent conditionally with "If-None-Match".
+ * If the server replies with "304 Not Modified", the request completes
+ * with response code 200 and the cached data, as if the data was freshly
+ * fetched. Servers that don't support ETag are not affected.
+ *
+ * The cache is initialized from @filename, if the file exists. Call
+ * nm_http_client_cache_save() to write it back. Only the entries for URLs that
+ * were requested in the meantime are saved.
+ */
+void
+nm_http_client_cache_load(NMHttpClient *self, const char *filename)
+{
+    NMHttpClientPrivate *priv               = NM_HTTP_CLIENT_GET_PRIVATE(self);
+    nm_auto_unref_keyfile GKeyFile *keyfile = NULL;
+    gs_free_error GError *error             = NULL;
+    gs_strfreev char **   groups            = NULL;
+    gsize                 i;
+
+    g_return_if_fail(filename);
+    g_return_if_fail(!priv->cache);
+
+    priv->cache = g_hash_table_new_full(nm_str_hash, g_str_equal, g_free, _cache_entry_free);
+    priv->cache_filename = g_strdup(filename);
+
+    keyfile = g_key_file_new();
+    if (!g_key_file_load_from_file(keyfile, filename, G_KEY_FILE_NONE, &error)) {
+        if (!g_error_matches(error, G_FILE_ERROR, G_FILE_ERROR_NOENT))
+            _LOGD("cache: failure to load \"%s\": %s", filename, error->message);
+        return;
+    }
+
+    groups = g_key_file_get_groups(keyfile, NULL);
+    for (i = 0; groups[i]; i++) {
+        gs_free char *  url  = NULL;
+        gs_free char *  etag = NULL;
+        gs_free char *  b64  = NULL;
+        gs_free guint8 *data = NULL;
+        gsize           data_len;
+        CacheEntry *    entry;
+
+        url  = g_key_file_get_string(keyfile, groups[i], "url", NULL);
+        etag = g_key_file_get_string(keyfile, groups[i], "etag", NULL);
+        b64  = g_key_file_get_string(keyfile, groups[i], "data", NULL);
+        if (!url || !url[0] || !etag || !etag[0] || !b64)
+            continue;
+
+        data = g_base64_decode(b64, &data_len);
+
+        entry  = g_slice_new(CacheEntry);
+        *entry = (CacheEntry){
+            .etag = g_steal_pointer(&etag),
+            .data = g_bytes_new_take(g_steal_pointer(&data), data_len),
+        };
+        g_hash_table_insert(priv->cache, g_steal_pointer(&url), entry);
+    }
+
+    _LOGD("cache: loaded %u entries from \"%s\"", g_hash_table_size(priv->cache), filename);
+}
+
+/**
+ * nm_http_client_cache_save:
+ * @self: the #NMHttpClient instance
+ *
+ * Persists the response cache to the file given to nm_http_client_cache_load(),
+ * if it changed. Entries for URLs that were not requested since loading the
+ * cache are dropped.
+ */
+void
+nm_http_client_cache_save(NMHttpClient *self)
+{
+    NMHttpClientPrivate *priv               = NM_HTTP_CLIENT_GET_PRIVATE(self);
+    nm_auto_unref_keyfile GKeyFile *keyfile = NULL;
+    gs_free_error GError *error             = NULL;
+    gs_free char *        contents          = NULL;
+    gsize                 contents_len;
+    GHashTableIter        h_iter;
+    const char *          url;
+    const CacheEntry *    entry;
+
+    if (!priv->cache)
+        return;
+
+    g_hash_table_iter_init(&h_iter, priv->cache);
+    while (g_hash_table_iter_next(&h_iter, NULL, (gpointer *) &entry)) {
+        if (!entry->used) {
+            g_hash_table_iter_remove(&h_iter);
+            priv->cache_dirty = TRUE;
+        }
+    }
+
+    if (!priv->cache_dirty)
+        return;
+
+    keyfile = g_key_file_new();
+
+    g_hash_table_iter_init(&h_iter, priv->cache);
+    while (g_hash_table_iter_next(&h_iter, (gpointer *) &url, (gpointer *) &entry)) {
+        gs_free char *group = NULL;
+        gs_free char *b64   = NULL;
+        gconstpointer data;
+        gsize         data_len;
+
+        group = _cache_group_name(url);
+        data  = g_bytes_get_data(entry->data, &data_len);
+        b64   = g_base64_encode(data, data_len);
+        g_key_file_set_string(keyfile, group, "url", url);
+        g_key_file_set_string(keyfile, group, "etag", entry->etag);
+        g_key_file_set_string(keyfile, group, "data", b64);
+    }
+
+    contents = g_key_file_to_data(keyfile, &contents_len, NULL);
+
+    if (!nm_utils_file_set_contents(priv->cache_filename,
+                                    contents,
+                                    contents_len,
+                                    0600,
+                                    NULL,
+                                    &error)) {
+        _LOGD("cache: failure to write \"%s\": %s", priv->cache_filename, error->message);
+        return;
+    }
+
+    priv->cache_dirty = FALSE;
+    _LOGD("cache: saved %u entries to \"%s\"",
+          g_hash_table_size(priv->cache),
+          priv->cache_filename);
+}
+
+/*****************************************************************************/
+
 typedef struct {
     GTask *            task;
     GSource *          timeout_source;
     CURLcode           ehandle_result;
     CURL *             ehandle;
     char *             url;
+    char *             etag;
     NMStrBuf           recv_data;
     struct curl_slist *headers;
     gssize             max_data;
@@ -148,15 +346,18 @@ _ehandle_free(EHandleData *edata)
     if (edata->headers)
         curl_slist_free_all(edata->headers);
     g_free(edata->url);
+    g_free(edata->etag);
     nm_g_slice_free(edata);
 }
 
 static void
 _ehandle_complete(EHandleData *edata, GError *error_take)
 {
-    GetResult *   get_result;
-    gs_free char *str_tmp_1     = NULL;
-    long          response_code = -1;
+    NMHttpClient *       self = g_task_get_source_object(edata->task);
+    NMHttpClientPrivate *priv = NM_HTTP_CLIENT_GET_PRIVATE(self);
+    GetResult *          get_result;
+    gs_free char *       str_tmp_1     = NULL;
+    long                 response_code = -1;
 
     nm_clear_pointer(&edata->timeout_source, nm_g_source_destroy_and_unref);
 
@@ -185,6 +386,28 @@ _ehandle_complete(EHandleData *edata, GError *error_take)
     if (curl_easy_getinfo(edata->ehandle, CURLINFO_RESPONSE_CODE, &response_code) != CURLE_OK)
         _LOG2E(edata, "failed to get response code from curl easy handle");
 
+    if (priv->cache && response_code == 304) {
+        const CacheEntry *entry;
+
+        entry = g_hash_table_lookup(priv->cache, edata->url);
+        if (entry) {
+            gconstpointer data;
+            gsize         data_len;
+
+            _LOG2D(edata, "not modified, use cached data");
+
+            /* the server may omit the ETag in the 304 reply. The cached one is
+             * still valid. */
+            if (!edata->etag)
+                edata->etag = g_strdup(entry->etag);
+
+            data = g_bytes_get_data(entry->data, &data_len);
+            nm_str_buf_reset(&edata->recv_data, NULL);
+            nm_str_buf_append_len(&edata->recv_data, data, data_len);
+            response_code = 200;
+        }
+    }
+
     _LOG2D(edata,
            "success getting %" G_GSIZE_FORMAT " bytes (response code %ld)",
            edata->recv_data.len,
@@ -208,6 +431,9 @@ _ehandle_complete(EHandleData *edata, GError *error_take)
         .response_data = nm_str_buf_finalize_to_gbytes(&edata->recv_data),
     };
 
+    if (priv->cache && response_code == 200)
+        _cache_entry_set(self, edata->url, edata->etag, get_result->response_data);
+
     g_task_return_pointer(edata->task, get_result, _get_result_free);
 
     _ehandle_free(edata);
@@ -236,6 +462,35 @@ _get_writefunction_cb(char *ptr, size_t size, size_t nmemb, void *user_data)
     return nconsume;
 }
 
+static size_t
+_get_headerfunction_cb(char *buffer, size_t size, size_t nitems, void *user_data)
+{
+    EHandleData *edata = user_data;
+    gsize        len   = size * nitems;
+
+    if (len > NM_STRLEN("ETag:") && g_ascii_strncasecmp(buffer, "ETag:", NM_STRLEN("ETag:")) == 0) {
+        nm_clear_g_free(&edata->etag);
+        edata->etag = g_strstrip(g_strndup(&buffer[NM_STRLEN("ETag:")], len - NM_STRLEN("ETag:")));
+        if (!edata->etag[0])
+            nm_clear_g_free(&edata->etag);
+    }
+
+    return len;
+}
+
+static void
+_get_append_header(EHandleData *edata, const char *header)
+{
+    struct curl_slist *tmp;
+
+    tmp = curl_slist_append(edata->headers, header);
+    if (!tmp) {
+        _LOGE("curl: curl_slist_append() failed adding %s", header);
+        return;
+    }
+    edata->headers = tmp;
+}
+
 static gboolean
 _get_timeout_cb(gpointer user_data)
 {
@@ -268,6 +523,7 @@ nm_http_client_get(NMHttpClient *      self,
 {
     NMHttpClientPrivate *priv;
     EHandleData *        edata;
+    CacheEntry *         entry;
     guint                i;
 
     g_return_if_fail(NM_IS_HTTP_CLIENT(self));
@@ -307,20 +563,27 @@ nm_http_client_get(NMHttpClient *      self,
     curl_easy_setopt(edata->ehandle, CURLOPT_PRIVATE, edata);
 
     if (http_headers) {
-        for (i = 0; http_headers[i]; ++i) {
-            struct curl_slist *tmp;
-
-            tmp = curl_slist_append(edata->headers, http_headers[i]);
-            if (!tmp) {
-                curl_slist_free_all(tmp);
-                _LOGE("curl: curl_slist_append() failed adding %s", http_headers[i]);
-                continue;
-            }
-            edata->headers = tmp;
+        for (i = 0; http_headers[i]; ++i)
+            _get_append_header(edata, http_headers[i]);
+    }
+
+    if (priv->cache) {
+        curl_easy_setopt(edata->ehandle, CURLOPT_HEADERFUNCTION, _get_headerfunction_cb);
+        curl_easy_setopt(edata->ehandle, CURLOPT_HEADERDATA, edata);
+
+        entry = g_hash_table_lookup(priv->cache, url);
+        if (entry) {
+            gs_free char *header = NULL;
+
+            entry->used = TRUE;
+
+            header = g_strdup_printf("If-None-Match: %s", entry->etag);
+            _get_append_header(edata, header);
         }
+    }
 
+    if (edata->headers)
         curl_easy_setopt(edata->ehandle, CURLOPT_HTTPHEADER, edata->headers);
-    }
 
     if (timeout_msec > 0) {
         edata->timeout_source = _source_attach(self,
@@ -750,6 +1013,20 @@ constructed(GObject *object)
         curl_multi_setopt(priv->mhandle, CURLMOPT_SOCKETDATA, self);
         curl_multi_setopt(priv->mhandle, CURLMOPT_TIMERFUNCTION, _mhandle_timerfunction_cb);
         curl_multi_setopt(priv->mhandle, CURLMOPT_TIMERDATA, self);
+
+        /* All requests go to the same metadata host. Let them share (and reuse) a
+         * bounded number of connections instead of opening one per request. Further
+         * requests are queued by curl until a connection becomes free.
+         *
+         * We support libcurl since 7.24.0, so these options are only set when we build
+         * against a version that has them. */
+#if LIBCURL_VERSION_NUM >= 0x072b00 /* 7.43.0 */
+        curl_multi_setopt(priv->mhandle, CURLMOPT_PIPELINING, (long) CURLPIPE_MULTIPLEX);
+#endif
+#if LIBCURL_VERSION_NUM >= 0x071e00 /* 7.30.0 */
+        curl_multi_setopt(priv->mhandle, CURLMOPT_MAX_HOST_CONNECTIONS, (long) MAX_HOST_CONNECTIONS);
+#endif
+        curl_multi_setopt(priv->mhandle, CURLMOPT_MAXCONNECTS, (long) MAX_HOST_CONNECTIONS);
     }
 
     G_OBJECT_CLASS(nm_http_client_parent_class)->constructed(object);
@@ -769,6 +1046,8 @@ dispose(GObject *object)
 
     nm_clear_pointer(&priv->mhandle, curl_multi_cleanup);
     nm_clear_pointer(&priv->source_sockets_hashtable, g_hash_table_unref);
+    nm_clear_pointer(&priv->cache, g_hash_table_unref);
+    nm_clear_g_free(&priv->cache_filename);
 
     nm_clear_g_source_inst(&priv->mhandle_source_timeout);
 
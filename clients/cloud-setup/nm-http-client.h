@@ -27,6 +27,12 @@ GMainContext *nm_http_client_get_main_context(NMHttpClient *self);
 
 /*****************************************************************************/
 
+void nm_http_client_cache_load(NMHttpClient *self, const char *filename);
+
+void nm_http_client_cache_save(NMHttpClient *self);
+
+/*****************************************************************************/
+
 void nm_http_client_get(NMHttpClient *      self,
                         const char *        uri,
                         int                 timeout_msec,
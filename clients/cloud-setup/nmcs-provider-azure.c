@@ -17,8 +17,19 @@
 #define NM_AZURE_METADATA_URL_BASE /* $NM_AZURE_BASE/$NM_AZURE_API_VERSION */ \
     "/metadata/instance/network/interface/"
 
+static const char *
+_azure_base(void)
+{
+    static const char *base_cached = NULL;
+
+    return nmcs_utils_base_uri_get(&base_cached,
+                                   NMCS_ENV_VARIABLE("NM_CLOUD_SETUP_AZURE_HOST"),
+                                   NM_AZURE_BASE,
+                                   NULL);
+}
+
 #define _azure_uri_concat(...) \
-    nmcs_utils_uri_build_concat(NM_AZURE_BASE, __VA_ARGS__, NM_AZURE_API_VERSION)
+    nmcs_utils_uri_build_concat(_azure_base(), __VA_ARGS__, NM_AZURE_API_VERSION)
 #define _azure_uri_interfaces(...) _azure_uri_concat(NM_AZURE_METADATA_URL_BASE, ##__VA_ARGS__)
 
 /*****************************************************************************/
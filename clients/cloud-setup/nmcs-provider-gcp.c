@@ -16,12 +16,23 @@
 #define NM_GCP_HOST              "metadata.google.internal"
 #define NM_GCP_BASE              "http://" NM_GCP_HOST
 #define NM_GCP_API_VERSION       "/v1"
-#define NM_GCP_METADATA_URL_BASE NM_GCP_BASE "/computeMetadata" NM_GCP_API_VERSION "/instance"
+#define NM_GCP_METADATA_URL_BASE /* $NM_GCP_BASE */ "/computeMetadata" NM_GCP_API_VERSION "/instance"
 #define NM_GCP_METADATA_URL_NET  "/network-interfaces/"
 
 #define NM_GCP_METADATA_HEADER "Metadata-Flavor: Google"
 
-#define _gcp_uri_concat(...)     nmcs_utils_uri_build_concat(NM_GCP_METADATA_URL_BASE, __VA_ARGS__)
+static const char *
+_gcp_base(void)
+{
+    static const char *base_cached = NULL;
+
+    return nmcs_utils_base_uri_get(&base_cached,
+                                   NMCS_ENV_VARIABLE("NM_CLOUD_SETUP_GCP_HOST"),
+                                   NM_GCP_BASE,
+                                   NM_GCP_METADATA_URL_BASE);
+}
+
+#define _gcp_uri_concat(...)     nmcs_utils_uri_build_concat(_gcp_base(), __VA_ARGS__)
 #define _gcp_uri_interfaces(...) _gcp_uri_concat(NM_GCP_METADATA_URL_NET, ##__VA_ARGS__)
 
 /*****************************************************************************/
@@ -0,0 +1,307 @@
+/* SPDX-License-Identifier: LGPL-2.1+ */
+
+#include "nm-default.h"
+
+#include "nm-cloud-setup-utils.h"
+#include "nm-http-client.h"
+
+#include "nm-utils/nm-test-utils.h"
+
+/*****************************************************************************/
+
+/* A minimal HTTP server. It serves the same content for every path, and
+ * supports "If-None-Match" with the current ETag. */
+typedef struct {
+    GSocketService *service;
+    guint16         port;
+
+    GMutex lock;
+    char * etag;
+    char * content;
+    guint  n_requests;
+    guint  n_not_modified;
+    char * last_if_none_match;
+} TestServer;
+
+static char *
+_server_get_header(const char *request, const char *name)
+{
+    gs_strfreev char **lines = NULL;
+    gsize              l     = strlen(name);
+    gsize              i;
+
+    lines = g_strsplit(request, "\r\n", -1);
+    for (i = 0; lines[i]; i++) {
+        if (g_ascii_strncasecmp(lines[i], name, l) == 0 && lines[i][l] == ':')
+            return g_strstrip(g_strdup(&lines[i][l + 1]));
+    }
+    return NULL;
+}
+
+static gboolean
+_server_run_cb(GThreadedSocketService *service,
+               GSocketConnection *     connection,
+               GObject *               source_object,
+               gpointer                user_data)
+{
+    TestServer *   server        = user_data;
+    GInputStream * istream       = g_io_stream_get_input_stream(G_IO_STREAM(connection));
+    GOutputStream *ostream       = g_io_stream_get_output_stream(G_IO_STREAM(connection));
+    gs_free char * if_none_match = NULL;
+    gs_free char * response      = NULL;
+    char           buf[4096];
+    gsize          len = 0;
+    gssize         n;
+
+    buf[0] = '\0';
+    while (!strstr(buf, "\r\n\r\n")) {
+        n = g_input_stream_read(istream, &buf[len], sizeof(buf) - 1 - len, NULL, NULL);
+        if (n <= 0)
+            return TRUE;
+        len += n;
+        buf[len] = '\0';
+        if (len >= sizeof(buf) - 1)
+            return TRUE;
+    }
+
+    if_none_match = _server_get_header(buf, "If-None-Match");
+
+    g_mutex_lock(&server->lock);
+    server->n_requests++;
+    g_free(server->last_if_none_match);
+    server->last_if_none_match = g_strdup(if_none_match);
+    if (if_none_match && nm_streq(if_none_match, server->etag)) {
+        /* like some servers, don't repeat the ETag in the 304 reply. */
+        server->n_not_modified++;
+        response = g_strdup("HTTP/1.1 304 Not Modified\r\n"
+                            "Connection: close\r\n"
+                            "\r\n");
+    } else {
+        response = g_strdup_printf("HTTP/1.1 200 OK\r\n"
+                                   "ETag: %s\r\n"
+                                   "Content-Length: %zu\r\n"
+                                   "Connection: close\r\n"
+                                   "\r\n"
+                                   "%s",
+                                   server->etag,
+                                   strlen(server->content),
+                                   server->content);
+    }
+    g_mutex_unlock(&server->lock);
+
+    g_output_stream_write_all(ostream, response, strlen(response), NULL, NULL, NULL);
+    return TRUE;
+}
+
+static void
+_server_set_content(TestServer *server, const char *etag, const char *content)
+{
+    g_mutex_lock(&server->lock);
+    nm_utils_strdup_reset(&server->etag, etag);
+    nm_utils_strdup_reset(&server->content, content);
+    g_mutex_unlock(&server->lock);
+}
+
+static void
+_server_start(TestServer *server)
+{
+    gs_free_error GError *error = NULL;
+
+    *server = (TestServer){};
+    g_mutex_init(&server->lock);
+    _server_set_content(server, "\"v1\"", "content-v1");
+
+    server->service = g_threaded_socket_service_new(2);
+    server->port    = g_socket_listener_add_any_inet_port(G_SOCKET_LISTENER(server->service),
+                                                       NULL,
+                                                       &error);
+    nmtst_assert_success(server->port > 0, error);
+    g_signal_connect(server->service, "run", G_CALLBACK(_server_run_cb), server);
+    g_socket_service_start(server->service);
+}
+
+static void
+_server_stop(TestServer *server)
+{
+    g_socket_service_stop(server->service);
+    g_socket_listener_close(G_SOCKET_LISTENER(server->service));
+    g_clear_object(&server->service);
+    g_mutex_clear(&server->lock);
+    nm_clear_g_free(&server->etag);
+    nm_clear_g_free(&server->content);
+    nm_clear_g_free(&server->last_if_none_match);
+}
+
+/*****************************************************************************/
+
+typedef struct {
+    bool    done;
+    long    response_code;
+    GBytes *response_data;
+} GetData;
+
+static void
+_get_cb(GObject *source, GAsyncResult *result, gpointer user_data)
+{
+    GetData *data               = user_data;
+    gs_free_error GError *error = NULL;
+    gboolean              success;
+
+    success = nm_http_client_get_finish(NM_HTTP_CLIENT(source),
+                                        result,
+                                        &data->response_code,
+                                        &data->response_data,
+                                        &error);
+    nmtst_assert_success(success, error);
+    data->done = TRUE;
+}
+
+static void
+_get_assert(NMHttpClient *client, const char *url, const char *expected_content)
+{
+    GetData data = {};
+
+    nm_http_client_get(client, url, 5000, 100000, NULL, NULL, _get_cb, &data);
+    nmtst_main_context_iterate_until_assert(NULL, 5000, data.done);
+
+    g_assert_cmpint(data.response_code, ==, 200);
+    g_assert(data.response_data);
+    g_assert_cmpmem(g_bytes_get_data(data.response_data, NULL),
+                    g_bytes_get_size(data.response_data),
+                    expected_content,
+                    strlen(expected_content));
+    g_bytes_unref(data.response_data);
+}
+
+static GKeyFile *
+_cache_file_load(const char *filename, guint expected_n_entries)
+{
+    gs_free_error GError *error   = NULL;
+    GKeyFile *            keyfile = g_key_file_new();
+    gs_strfreev char **   groups  = NULL;
+    gsize                 n_groups;
+    gboolean              success;
+
+    success = g_key_file_load_from_file(keyfile, filename, G_KEY_FILE_NONE, &error);
+    nmtst_assert_success(success, error);
+
+    groups = g_key_file_get_groups(keyfile, &n_groups);
+    g_assert_cmpint(n_groups, ==, expected_n_entries);
+    return keyfile;
+}
+
+static gboolean
+_cache_file_has_url(GKeyFile *keyfile, const char *url, const char *expected_etag)
+{
+    gs_strfreev char **groups = NULL;
+    gsize              i;
+
+    groups = g_key_file_get_groups(keyfile, NULL);
+    for (i = 0; groups[i]; i++) {
+        gs_free char *u = g_key_file_get_string(keyfile, groups[i], "url", NULL);
+        gs_free char *e = NULL;
+
+        if (!nm_streq0(u, url))
+            continue;
+        e = g_key_file_get_string(keyfile, groups[i], "etag", NULL);
+        g_assert_cmpstr(e, ==, expected_etag);
+        return TRUE;
+    }
+    return FALSE;
+}
+
+static void
+test_http_client_cache(void)
+{
+    TestServer            server;
+    gs_free_error GError *error    = NULL;
+    gs_free char *        tmpdir   = NULL;
+    gs_free char *        filename = NULL;
+    gs_free char *        url_a    = NULL;
+    gs_free char *        url_b    = NULL;
+
+    _server_start(&server);
+
+    tmpdir = g_dir_make_tmp("nm-test-cloud-setup-XXXXXX", &error);
+    nmtst_assert_success(tmpdir, error);
+    filename = g_build_filename(tmpdir, "http-cache", NULL);
+
+    url_a = g_strdup_printf("http://127.0.0.1:%u/latest/meta-data/", server.port);
+    /* brackets are not valid in a keyfile group name. */
+    url_b = g_strdup_printf("http://127.0.0.1:%u/meta-data?addr=[1]", server.port);
+
+    /* the first run fetches everything and fills the cache. */
+    {
+        gs_unref_object NMHttpClient *client    = nm_http_client_new();
+        nm_auto_unref_keyfile GKeyFile *keyfile = NULL;
+
+        nm_http_client_cache_load(client, filename);
+        _get_assert(client, url_a, "content-v1");
+        g_assert_cmpstr(server.last_if_none_match, ==, NULL);
+        _get_assert(client, url_b, "content-v1");
+        g_assert_cmpstr(server.last_if_none_match, ==, NULL);
+        nm_http_client_cache_save(client);
+
+        keyfile = _cache_file_load(filename, 2);
+        g_assert(_cache_file_has_url(keyfile, url_a, "\"v1\""));
+        g_assert(_cache_file_has_url(keyfile, url_b, "\"v1\""));
+    }
+    g_assert_cmpint(server.n_requests, ==, 2);
+    g_assert_cmpint(server.n_not_modified, ==, 0);
+
+    /* the second run revalidates. The server replies "304 Not Modified" without
+     * repeating the ETag, which keeps the entry. The URL that was not requested
+     * is dropped from the cache. */
+    {
+        gs_unref_object NMHttpClient *client    = nm_http_client_new();
+        nm_auto_unref_keyfile GKeyFile *keyfile = NULL;
+
+        nm_http_client_cache_load(client, filename);
+        _get_assert(client, url_a, "content-v1");
+        g_assert_cmpstr(server.last_if_none_match, ==, "\"v1\"");
+        nm_http_client_cache_save(client);
+
+        keyfile = _cache_file_load(filename, 1);
+        g_assert(_cache_file_has_url(keyfile, url_a, "\"v1\""));
+        g_assert(!_cache_file_has_url(keyfile, url_b, NULL));
+    }
+    g_assert_cmpint(server.n_requests, ==, 3);
+    g_assert_cmpint(server.n_not_modified, ==, 1);
+
+    /* the content changed. The conditional request gets the new data. */
+    _server_set_content(&server, "\"v2\"", "content-v2");
+    {
+        gs_unref_object NMHttpClient *client    = nm_http_client_new();
+        nm_auto_unref_keyfile GKeyFile *keyfile = NULL;
+
+        nm_http_client_cache_load(client, filename);
+        _get_assert(client, url_a, "content-v2");
+        g_assert_cmpstr(server.last_if_none_match, ==, "\"v1\"");
+        nm_http_client_cache_save(client);
+
+        keyfile = _cache_file_load(filename, 1);
+        g_assert(_cache_file_has_url(keyfile, url_a, "\"v2\""));
+    }
+    g_assert_cmpint(server.n_requests, ==, 4);
+    g_assert_cmpint(server.n_not_modified, ==, 1);
+
+    g_assert_cmpint(unlink(filename), ==, 0);
+    g_assert_cmpint(rmdir(tmpdir), ==, 0);
+    _server_stop(&server);
+}
+
+/*****************************************************************************/
+
+NMTST_DEFINE();
+
+int
+main(int argc, char **argv)
+{
+    nmtst_init(&argc, &argv, TRUE);
+
+    _nm_logging_enabled_init(nmtst_is_debug() ? "TRACE" : "WARN");
+
+    g_test_add_func("/cloud-setup/http-client/cache", test_http_client_cache);
+
+    return g_test_run();
+}
@@ -23,19 +23,52 @@
 
 typedef struct Request Request;
 
+typedef enum {
+    SCRIPT_DIR_DEFAULT,
+    SCRIPT_DIR_PRE_UP,
+    SCRIPT_DIR_PRE_DOWN,
+    _SCRIPT_DIR_NUM,
+} ScriptDir;
+
+typedef struct {
+    char *   path;
+    gboolean wait;
+} ScriptEntry;
+
 static struct {
     GDBusConnection *dbus_connection;
     GMainLoop *      loop;
     gboolean         debug;
     gboolean         persist;
+    int              max_parallel;
     guint            quit_id;
     guint            request_id_counter;
     gboolean         ever_acquired_name;
     bool             exit_with_failure;
 
-    Request *current_request;
-    GQueue * requests_waiting;
-    int      num_requests_pending;
+    /* requests with "wait" scripts, waiting for their turn. */
+    GQueue *requests_waiting;
+
+    /* the requests that currently run their "wait" scripts, by interface.
+     * There is at most one running request per interface. */
+    GHashTable *requests_running;
+
+    int num_requests_pending;
+
+    /* The sorted list of ScriptEntry per script directory, or %NULL if the
+     * directories need to be re-scanned. The cache is invalidated by
+     * @script_monitors. */
+    GPtrArray *script_cache[_SCRIPT_DIR_NUM];
+    GPtrArray *script_monitors;
+    bool       script_cache_disabled;
+
+    struct {
+        guint64 num_requests;
+        guint64 queue_time_total_usec;
+        guint64 queue_time_max_usec;
+        guint64 run_time_total_usec;
+        guint64 run_time_max_usec;
+    } stats;
 } gl;
 
 typedef struct {
@@ -59,6 +92,10 @@ struct Request {
     char *                 iface;
     char **                envp;
     gboolean               debug;
+    gboolean               running;
+
+    gint64 time_received_usec;
+    gint64 time_started_usec;
 
     GPtrArray *scripts; /* list of ScriptInfo */
     guint      idx;
@@ -158,6 +195,7 @@ struct Request {
 /*****************************************************************************/
 
 static gboolean dispatch_one_script(Request *request);
+static void     complete_request(Request *request);
 
 /*****************************************************************************/
 
@@ -202,44 +240,80 @@ quit_timeout_reschedule(void)
     }
 }
 
+static const char *
+request_get_queue_key(const Request *request)
+{
+    /* Requests for the same interface are serialized. Requests without
+     * interface (hostname, connectivity-change) are serialized among each other. */
+    return request->iface ?: "";
+}
+
+static void
+request_acquire(Request *request)
+{
+    nm_assert(!request->running);
+    nm_assert(!g_hash_table_contains(gl.requests_running, request_get_queue_key(request)));
+
+    request->running           = TRUE;
+    request->time_started_usec = g_get_monotonic_time();
+    g_hash_table_insert(gl.requests_running, (gpointer) request_get_queue_key(request), request);
+
+    _LOG_R_D(request, "start running ordered scripts...");
+}
+
+static void
+request_release(Request *request)
+{
+    nm_assert(request->running);
+    nm_assert(g_hash_table_lookup(gl.requests_running, request_get_queue_key(request)) == request);
+
+    request->running = FALSE;
+    g_hash_table_remove(gl.requests_running, request_get_queue_key(request));
+}
+
 /**
- * next_request:
+ * schedule_requests:
  *
- * @request: (allow-none): the request to set as next. If %NULL, dequeue the next
- * waiting request. Otherwise, try to set the given request.
+ * Starts waiting requests, in the order they were received, as long as
+ * there are less than @max_parallel requests running. A request is only
+ * started if no other request for the same interface is currently running,
+ * so that the scripts for one interface are always run in order.
  *
- * Sets the currently active request (@current_request). The current request
- * is a request that has at least on "wait" script, because requests that only
- * consist of "no-wait" scripts are handled right away and not enqueued to
- * @requests_waiting nor set as @current_request.
- *
- * Returns: %TRUE, if there was currently not request in process and it set
- * a new request as current.
+ * Only requests that have at least one "wait" script are enqueued to
+ * @requests_waiting. Requests that only consist of "no-wait" scripts are
+ * handled right away.
  */
-static gboolean
-next_request(Request *request)
+static void
+schedule_requests(void)
 {
-    if (request) {
-        if (gl.current_request) {
-            g_queue_push_tail(gl.requests_waiting, request);
-            return FALSE;
-        }
-    } else {
-        /* when calling next_request() without explicit @request, we always
-         * forcefully clear @current_request. That one is certainly
-         * handled already. */
-        gl.current_request = NULL;
+    GList *iter;
+    GList *iter_next;
 
-        request = g_queue_pop_head(gl.requests_waiting);
-        if (!request)
-            return FALSE;
-    }
+    for (iter = g_queue_peek_head_link(gl.requests_waiting);
+         iter && (int) g_hash_table_size(gl.requests_running) < gl.max_parallel;
+         iter = iter_next) {
+        Request *request = iter->data;
 
-    _LOG_R_D(request, "start running ordered scripts...");
+        iter_next = iter->next;
 
-    gl.current_request = request;
+        if (g_hash_table_contains(gl.requests_running, request_get_queue_key(request)))
+            continue;
 
-    return TRUE;
+        g_queue_delete_link(gl.requests_waiting, iter);
+
+        request_acquire(request);
+
+        if (dispatch_one_script(request))
+            continue;
+
+        /* The request has no more "wait" scripts. Try to complete it. It will
+         * be either completed now, or when all pending "no-wait" scripts return. */
+        request_release(request);
+        complete_request(request);
+
+        /* Continue with the next request. Note that @iter_next is still valid,
+         * because complete_request() does not modify @requests_waiting. */
+    }
 }
 
 /**
@@ -256,9 +330,13 @@ complete_request(Request *request)
 {
     GVariantBuilder results;
     GVariant *      ret;
+    gint64          now_usec;
+    gint64          queue_time_usec;
+    gint64          run_time_usec;
     guint           i;
 
     nm_assert(request);
+    nm_assert(!request->running);
 
     /* Are there still pending scripts? Then do nothing (for now). */
     if (request->num_scripts_done < request->scripts->len)
@@ -278,16 +356,29 @@ complete_request(Request *request)
     ret = g_variant_new("(a(sus))", &results);
     g_dbus_method_invocation_return_value(request->context, ret);
 
-    _LOG_R_T(request, "completed (%u scripts)", request->scripts->len);
+    now_usec        = g_get_monotonic_time();
+    queue_time_usec = (request->time_started_usec ?: now_usec) - request->time_received_usec;
+    run_time_usec   = now_usec - request->time_received_usec - queue_time_usec;
+
+    gl.stats.num_requests++;
+    gl.stats.queue_time_total_usec += queue_time_usec;
+    gl.stats.queue_time_max_usec = NM_MAX(gl.stats.queue_time_max_usec, (guint64) queue_time_usec);
+    gl.stats.run_time_total_usec += run_time_usec;
+    gl.stats.run_time_max_usec = NM_MAX(gl.stats.run_time_max_usec, (guint64) run_time_usec);
 
-    if (gl.current_request == request)
-        gl.current_request = NULL;
+    _LOG_R_T(request,
+             "completed (%u scripts, queued %" G_GINT64_FORMAT " msec, ran %" G_GINT64_FORMAT
+             " msec)",
+             request->scripts->len,
+             queue_time_usec / 1000,
+             run_time_usec / 1000);
 
     request_free(request);
 
     g_assert_cmpuint(gl.num_requests_pending, >, 0);
     if (--gl.num_requests_pending <= 0) {
-        nm_assert(!gl.current_request && !g_queue_peek_head(gl.requests_waiting));
+        nm_assert(g_hash_table_size(gl.requests_running) == 0
+                  && !g_queue_peek_head(gl.requests_waiting));
         quit_timeout_reschedule();
     }
 }
@@ -295,65 +386,29 @@ complete_request(Request *request)
 static void
 complete_script(ScriptInfo *script)
 {
-    Request *request;
-    gboolean wait = script->wait;
+    Request *request = script->request;
 
-    request = script->request;
+    nm_assert(!script->wait || request->running);
 
-    if (wait) {
-        /* for "wait" scripts, try to schedule the next blocking script.
-         * If that is successful, return (as we must wait for its completion). */
+    if (request->running) {
+        /* The request is running. Try to schedule its next "wait" script. If
+         * that is successful (or if there are still "no-wait" scripts pending,
+         * which must complete first), return as we must wait for their completion. */
         if (dispatch_one_script(request))
             return;
-    }
 
-    nm_assert(!wait || gl.current_request == request);
+        /* we just completed the last script of the running @request. Make room
+         * for the next request on this interface. */
+        request_release(request);
+    }
 
     /* Try to complete the request. @request will be possibly free'd,
-     * making @script and @request a dangling pointer. */
+     * making @script and @request a dangling pointer. For a "no-wait" script
+     * of a request that is not running, there may still be other scripts
+     * pending, and the request will be completed later. */
     complete_request(request);
 
-    if (!wait) {
-        /* this was a "no-wait" script. We either completed the request,
-         * or there is nothing to do. Especially, there is no need to
-         * queue the next_request() -- because no-wait scripts don't block
-         * requests. However, if this was the last "no-wait" script and
-         * there are "wait" scripts ready to run, launch them.
-         */
-        if (gl.current_request == request && gl.current_request->num_scripts_nowait == 0) {
-            if (dispatch_one_script(gl.current_request))
-                return;
-
-            complete_request(gl.current_request);
-        } else
-            return;
-    } else {
-        /* if the script is a "wait" script, we already tried above to
-         * dispatch the next script. As we didn't do that, it means we
-         * just completed the last script of @request and we can continue
-         * with the next request...
-         *
-         * Also, it cannot be that there is another request currently being
-         * processed because only requests with "wait" scripts can become
-         * @current_request. As there can only be one "wait" script running
-         * at any time, it means complete_request() above completed @request. */
-        nm_assert(!gl.current_request);
-    }
-
-    while (next_request(NULL)) {
-        request = gl.current_request;
-
-        if (dispatch_one_script(request))
-            return;
-
-        /* Try to complete the request. It will be either completed
-         * now, or when all pending "no-wait" scripts return. */
-        complete_request(request);
-
-        /* We can immediately start next_request(), because our current
-         * @request has obviously no more "wait" scripts either.
-         * Repeat... */
-    }
+    schedule_requests();
 }
 
 static void
@@ -597,28 +652,69 @@ _find_scripts(Request *request, GHashTable *scripts, const char *base, const cha
     g_dir_close(dir);
 }
 
-static GSList *
-find_scripts(Request *request)
+static gboolean
+script_must_wait(const char *path)
 {
-    gs_unref_hashtable GHashTable *scripts     = NULL;
-    GSList *                       script_list = NULL;
+    gs_free char *link = NULL;
+
+    link = g_file_read_link(path, NULL);
+    if (link) {
+        gs_free char *     dir  = NULL;
+        nm_auto_free char *real = NULL;
+
+        if (!g_path_is_absolute(link)) {
+            char *tmp;
+
+            dir = g_path_get_dirname(path);
+            tmp = g_build_path("/", dir, link, NULL);
+            g_free(link);
+            g_free(dir);
+            link = tmp;
+        }
+
+        dir  = g_path_get_dirname(link);
+        real = realpath(dir, NULL);
+        if (NM_STR_HAS_SUFFIX(real, "/no-wait.d"))
+            return FALSE;
+    }
+
+    return TRUE;
+}
+
+static int
+_compare_script_entries(gconstpointer a, gconstpointer b)
+{
+    const ScriptEntry *entry_a = *((const ScriptEntry *const *) a);
+    const ScriptEntry *entry_b = *((const ScriptEntry *const *) b);
+
+    return _compare_basenames(entry_a->path, entry_b->path);
+}
+
+static void
+script_entry_free(gpointer ptr)
+{
+    ScriptEntry *entry = ptr;
+
+    g_free(entry->path);
+    g_slice_free(ScriptEntry, entry);
+}
+
+static GPtrArray *
+_find_scripts_uncached(Request *request, const char *subdir)
+{
+    gs_unref_hashtable GHashTable *scripts = NULL;
+    GPtrArray *                    entries;
     GHashTableIter                 iter;
-    const char *                   subdir;
     char *                         path;
     char *                         filename;
 
-    if (NM_IN_STRSET(request->action, NMD_ACTION_PRE_UP, NMD_ACTION_VPN_PRE_UP))
-        subdir = "pre-up.d";
-    else if (NM_IN_STRSET(request->action, NMD_ACTION_PRE_DOWN, NMD_ACTION_VPN_PRE_DOWN))
-        subdir = "pre-down.d";
-    else
-        subdir = NULL;
-
     scripts = g_hash_table_new_full(nm_str_hash, g_str_equal, g_free, g_free);
 
     _find_scripts(request, scripts, NMLIBDIR, subdir);
     _find_scripts(request, scripts, NMCONFDIR, subdir);
 
+    entries = g_ptr_array_new_with_free_func(script_entry_free);
+
     g_hash_table_iter_init(&iter, scripts);
     while (g_hash_table_iter_next(&iter, (gpointer *) &filename, (gpointer *) &path)) {
         gs_free char *link_target = NULL;
@@ -638,42 +734,141 @@ find_scripts(Request *request)
         } else if (!check_permissions(&st, &err_msg))
             _LOG_R_W(request, "find-scripts: Cannot execute '%s': %s", path, err_msg);
         else {
+            ScriptEntry *entry;
+
             /* success */
-            script_list = g_slist_prepend(script_list, g_strdup(path));
+            entry  = g_slice_new(ScriptEntry);
+            *entry = (ScriptEntry){
+                .path = g_strdup(path),
+                .wait = script_must_wait(path),
+            };
+            g_ptr_array_add(entries, entry);
             continue;
         }
     }
 
-    return g_slist_sort(script_list, _compare_basenames);
+    g_ptr_array_sort(entries, _compare_script_entries);
+    return entries;
 }
 
-static gboolean
-script_must_wait(const char *path)
+static void
+script_cache_invalidate(void)
 {
-    gs_free char *link = NULL;
+    int i;
 
-    link = g_file_read_link(path, NULL);
-    if (link) {
-        gs_free char *     dir  = NULL;
-        nm_auto_free char *real = NULL;
+    for (i = 0; i < _SCRIPT_DIR_NUM; i++)
+        nm_clear_pointer(&gl.script_cache[i], g_ptr_array_unref);
+}
 
-        if (!g_path_is_absolute(link)) {
-            char *tmp;
+static void
+_script_monitor_changed_cb(GFileMonitor *    monitor,
+                           GFile *           file,
+                           GFile *           other_file,
+                           GFileMonitorEvent event_type,
+                           gpointer          user_data)
+{
+    if (gl.script_cache[SCRIPT_DIR_DEFAULT] || gl.script_cache[SCRIPT_DIR_PRE_UP]
+        || gl.script_cache[SCRIPT_DIR_PRE_DOWN])
+        _LOG_X_T("find-scripts: dispatcher directory changed, drop cached scripts");
+    script_cache_invalidate();
+}
 
-            dir = g_path_get_dirname(path);
-            tmp = g_build_path("/", dir, link, NULL);
-            g_free(link);
-            g_free(dir);
-            link = tmp;
+static void
+script_monitors_setup(void)
+{
+    static const char *const bases[]   = {NMLIBDIR, NMCONFDIR};
+    static const char *const subdirs[] = {NULL, "pre-up.d", "pre-down.d", "no-wait.d"};
+    guint                    i, j;
+
+    if (gl.script_monitors || gl.script_cache_disabled)
+        return;
+
+    gl.script_monitors = g_ptr_array_new_with_free_func(g_object_unref);
+
+    /* Watch the dispatcher directories with inotify, so that we don't need
+     * to re-scan them for each request. The directories don't need to exist. The
+     * "no-wait.d" directories are watched too, because they determine whether
+     * a symlinked script is a "wait" script. */
+    for (i = 0; i < G_N_ELEMENTS(bases); i++) {
+        for (j = 0; j < G_N_ELEMENTS(subdirs); j++) {
+            gs_free_error GError *error   = NULL;
+            gs_free char *        dirname = NULL;
+            gs_unref_object GFile *file   = NULL;
+            GFileMonitor *         monitor;
+
+            dirname = g_build_filename(bases[i], "dispatcher.d", subdirs[j], NULL);
+            file    = g_file_new_for_path(dirname);
+            monitor = g_file_monitor_directory(file, G_FILE_MONITOR_NONE, NULL, &error);
+            if (!monitor) {
+                _LOG_X_W("find-scripts: cannot watch directory '%s' (%s). Scripts won't be cached",
+                         dirname,
+                         error->message);
+                gl.script_cache_disabled = TRUE;
+                nm_clear_pointer(&gl.script_monitors, g_ptr_array_unref);
+                return;
+            }
+            g_signal_connect(monitor,
+                             "changed",
+                             G_CALLBACK(_script_monitor_changed_cb),
+                             NULL);
+            g_ptr_array_add(gl.script_monitors, monitor);
         }
+    }
+}
 
-        dir  = g_path_get_dirname(link);
-        real = realpath(dir, NULL);
-        if (NM_STR_HAS_SUFFIX(real, "/no-wait.d"))
-            return FALSE;
+static void
+script_monitors_clear(void)
+{
+    guint i;
+
+    if (gl.script_monitors) {
+        for (i = 0; i < gl.script_monitors->len; i++) {
+            GFileMonitor *monitor = gl.script_monitors->pdata[i];
+
+            g_signal_handlers_disconnect_by_func(monitor, _script_monitor_changed_cb, NULL);
+            g_file_monitor_cancel(monitor);
+        }
+        nm_clear_pointer(&gl.script_monitors, g_ptr_array_unref);
     }
+    script_cache_invalidate();
+}
 
-    return TRUE;
+/**
+ * find_scripts:
+ * @request: the request
+ *
+ * Returns: (transfer full): the sorted list of #ScriptEntry for the
+ *   action of @request. The list is cached until the content of the
+ *   dispatcher directories changes.
+ */
+static GPtrArray *
+find_scripts(Request *request)
+{
+    ScriptDir   script_dir;
+    const char *subdir;
+
+    if (NM_IN_STRSET(request->action, NMD_ACTION_PRE_UP, NMD_ACTION_VPN_PRE_UP)) {
+        script_dir = SCRIPT_DIR_PRE_UP;
+        subdir     = "pre-up.d";
+    } else if (NM_IN_STRSET(request->action, NMD_ACTION_PRE_DOWN, NMD_ACTION_VPN_PRE_DOWN)) {
+        script_dir = SCRIPT_DIR_PRE_DOWN;
+        subdir     = "pre-down.d";
+    } else {
+        script_dir = SCRIPT_DIR_DEFAULT;
+        subdir     = NULL;
+    }
+
+    script_monitors_setup();
+
+    if (gl.script_cache_disabled)
+        return _find_scripts_uncached(request, subdir);
+
+    if (!gl.script_cache[script_dir])
+        gl.script_cache[script_dir] = _find_scripts_uncached(request, subdir);
+    else
+        _LOG_R_T(request, "find-scripts: use cached scripts");
+
+    return g_ptr_array_ref(gl.script_cache[script_dir]);
 }
 
 static void
@@ -694,9 +889,8 @@ _method_call_action(GDBusMethodInvocation *invocation, GVariant *parameters)
     gs_unref_variant GVariant *vpn_ip4_config       = NULL;
     gs_unref_variant GVariant *vpn_ip6_config       = NULL;
     gboolean                   debug;
-    GSList *                   sorted_scripts = NULL;
-    GSList *                   iter;
-    Request *                  request;
+    gs_unref_ptrarray GPtrArray *sorted_scripts = NULL;
+    Request *                    request;
     char **                    p;
     guint                      i, num_nowait = 0;
     const char *               error_message = NULL;
@@ -735,11 +929,12 @@ _method_call_action(GDBusMethodInvocation *invocation, GVariant *parameters)
                   &vpn_ip6_config,
                   &debug);
 
-    request             = g_slice_new0(Request);
-    request->request_id = ++gl.request_id_counter;
-    request->debug      = debug || gl.debug;
-    request->context    = invocation;
-    request->action     = g_strdup(action);
+    request                     = g_slice_new0(Request);
+    request->request_id         = ++gl.request_id_counter;
+    request->debug              = debug || gl.debug;
+    request->context            = invocation;
+    request->action             = g_strdup(action);
+    request->time_received_usec = g_get_monotonic_time();
 
     request->envp = nm_dispatcher_utils_construct_envp(action,
                                                        connection,
@@ -761,16 +956,16 @@ _method_call_action(GDBusMethodInvocation *invocation, GVariant *parameters)
     request->scripts = g_ptr_array_new_full(5, script_info_free);
 
     sorted_scripts = find_scripts(request);
-    for (iter = sorted_scripts; iter; iter = g_slist_next(iter)) {
-        ScriptInfo *s;
+    for (i = 0; i < sorted_scripts->len; i++) {
+        const ScriptEntry *entry = sorted_scripts->pdata[i];
+        ScriptInfo *       s;
 
         s          = g_slice_new0(ScriptInfo);
         s->request = request;
-        s->script  = iter->data;
-        s->wait    = script_must_wait(s->script);
+        s->script  = g_strdup(entry->path);
+        s->wait    = entry->wait;
         g_ptr_array_add(request->scripts, s);
     }
-    g_slist_free(sorted_scripts);
 
     _LOG_R_D(request, "new request (%u scripts)", request->scripts->len);
     if (_LOG_R_T_enabled(request) && request->envp) {
@@ -807,39 +1002,64 @@ _method_call_action(GDBusMethodInvocation *invocation, GVariant *parameters)
     }
 
     if (num_nowait < request->scripts->len) {
-        /* The request has at least one wait script.
-         * Try next_request() to schedule the request for
-         * execution. This either enqueues the request or
-         * sets it as gl.current_request. */
-        if (next_request(request)) {
-            /* @request is now @current_request. Go ahead and
-             * schedule the first wait script. */
-            if (!dispatch_one_script(request)) {
-                /* If that fails, we might be already finished with the
-                 * request. Try complete_request(). */
-                complete_request(request);
-
-                if (next_request(NULL)) {
-                    /* As @request was successfully scheduled as next_request(), there is no
-                     * other request in queue that can be scheduled afterwards. Assert against
-                     * that, but call next_request() to clear current_request. */
-                    g_assert_not_reached();
-                }
-            }
-        }
+        /* The request has at least one wait script. Enqueue it and
+         * let schedule_requests() start it, once there are no earlier
+         * requests for the same interface. */
+        g_queue_push_tail(gl.requests_waiting, request);
+        schedule_requests();
     } else {
         /* The request contains only no-wait scripts. Try to complete
          * the request right away (we might have failed to schedule any
          * of the scripts). It will be either completed now, or later
          * when the pending scripts return.
-         * We don't enqueue it to gl.requests_waiting.
-         * There is no need to handle next_request(), because @request is
-         * not the current request anyway and does not interfere with requests
-         * that have any "wait" scripts. */
+         * We don't enqueue it to gl.requests_waiting, because no-wait
+         * scripts don't block requests. */
         complete_request(request);
     }
 }
 
+static void
+_method_call_get_statistics(GDBusMethodInvocation *invocation)
+{
+    GVariantBuilder builder;
+
+    g_variant_builder_init(&builder, G_VARIANT_TYPE("a{sv}"));
+    g_variant_builder_add(&builder,
+                          "{sv}",
+                          "requests-completed",
+                          g_variant_new_uint64(gl.stats.num_requests));
+    g_variant_builder_add(&builder,
+                          "{sv}",
+                          "requests-running",
+                          g_variant_new_uint32(g_hash_table_size(gl.requests_running)));
+    g_variant_builder_add(&builder,
+                          "{sv}",
+                          "requests-waiting",
+                          g_variant_new_uint32(g_queue_get_length(gl.requests_waiting)));
+    g_variant_builder_add(&builder,
+                          "{sv}",
+                          "max-parallel",
+                          g_variant_new_uint32(gl.max_parallel));
+    g_variant_builder_add(&builder,
+                          "{sv}",
+                          "queue-time-total-usec",
+                          g_variant_new_uint64(gl.stats.queue_time_total_usec));
+    g_variant_builder_add(&builder,
+                          "{sv}",
+                          "queue-time-max-usec",
+                          g_variant_new_uint64(gl.stats.queue_time_max_usec));
+    g_variant_builder_add(&builder,
+                          "{sv}",
+                          "run-time-total-usec",
+                          g_variant_new_uint64(gl.stats.run_time_total_usec));
+    g_variant_builder_add(&builder,
+                          "{sv}",
+                          "run-time-max-usec",
+                          g_variant_new_uint64(gl.stats.run_time_max_usec));
+
+    g_dbus_method_invocation_return_value(invocation, g_variant_new("(a{sv})", &builder));
+}
+
 static void
 on_name_acquired(GDBusConnection *connection, const char *name, gpointer user_data)
 {
@@ -880,6 +1100,10 @@ _method_call(GDBusConnection *      connection,
             _method_call_action(invocation, parameters);
             return;
         }
+        if (nm_streq(method_name, "GetStatistics")) {
+            _method_call_get_statistics(invocation);
+            return;
+        }
     }
     g_dbus_method_invocation_return_error(invocation,
                                           G_DBUS_ERROR,
@@ -910,7 +1134,10 @@ static GDBusInterfaceInfo *const interface_info = NM_DEFINE_GDBUS_INTERFACE_INFO
                 NM_DEFINE_GDBUS_ARG_INFO("vpn_ip6_config", "a{sv}"),
                 NM_DEFINE_GDBUS_ARG_INFO("debug", "b"), ),
             .out_args =
-                NM_DEFINE_GDBUS_ARG_INFOS(NM_DEFINE_GDBUS_ARG_INFO("results", "a(sus)"), ), ), ), );
+                NM_DEFINE_GDBUS_ARG_INFOS(NM_DEFINE_GDBUS_ARG_INFO("results", "a(sus)"), ), ),
+        NM_DEFINE_GDBUS_METHOD_INFO(
+            "GetStatistics",
+            .out_args = NM_DEFINE_GDBUS_ARG_INFOS(NM_DEFINE_GDBUS_ARG_INFO("statistics", "a{sv}"), ), ), ), );
 
 static const GDBusInterfaceVTable interface_vtable = {
     .method_call = _method_call,
@@ -982,6 +1209,13 @@ parse_command_line(int *p_argc, char ***p_argv, GError **error)
     GOptionEntry    entries[] = {
         {"debug", 0, 0, G_OPTION_ARG_NONE, &gl.debug, "Output to console rather than syslog", NULL},
         {"persist", 0, 0, G_OPTION_ARG_NONE, &gl.persist, "Don't quit after a short timeout", NULL},
+        {"max-parallel",
+         0,
+         0,
+         G_OPTION_ARG_INT,
+         &gl.max_parallel,
+         "Run requests for up to N interfaces in parallel (default: 1)",
+         "N"},
         {NULL}};
     gboolean success;
 
@@ -993,6 +1227,9 @@ parse_command_line(int *p_argc, char ***p_argv, GError **error)
 
     g_option_context_free(opt_ctx);
 
+    if (success && gl.max_parallel <= 0)
+        gl.max_parallel = 1;
+
     return success;
 }
 
@@ -1036,6 +1273,7 @@ main(int argc, char **argv)
     }
 
     gl.requests_waiting = g_queue_new();
+    gl.requests_running = g_hash_table_new(nm_str_hash, g_str_equal);
 
     dbus_regist_id =
         g_dbus_connection_register_object(gl.dbus_connection,
@@ -1087,6 +1325,8 @@ done:
         g_dbus_connection_unregister_object(gl.dbus_connection, nm_steal_int(&dbus_regist_id));
 
     nm_clear_pointer(&gl.requests_waiting, g_queue_free);
+    nm_clear_pointer(&gl.requests_running, g_hash_table_unref);
+    script_monitors_clear();
 
     nm_clear_g_source(&signal_id_term);
     nm_clear_g_source(&signal_id_int);
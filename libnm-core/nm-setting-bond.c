@@ -236,6 +236,55 @@ _nm_setting_bond_option_supported(const char *option, NMBondMode mode)
     return !NM_FLAGS_ANY(_bond_option_unsupp_mode(option), BIT(mode));
 }
 
+/**
+ * _nm_setting_bond_option_value_to_uint:
+ * @option: the name of a bond option of integer or enumeration type
+ * @value: the string value of the option
+ * @out_value: (out): the numeric value as used by kernel
+ *
+ * For options of type %NM_BOND_OPTION_TYPE_BOTH, kernel accepts either
+ * the name or the numeric value. The numeric value of a name is the
+ * index in the list of valid values.
+ *
+ * Returns: %TRUE if @value is valid for @option and could be converted.
+ */
+gboolean
+_nm_setting_bond_option_value_to_uint(const char *option, const char *value, guint32 *out_value)
+{
+    const OptionMeta *option_meta;
+    gint64            v;
+    guint             i;
+
+    nm_assert(out_value);
+
+    option_meta = _get_option_meta(option);
+    if (!option_meta || !value)
+        return FALSE;
+
+    switch (option_meta->opt_type) {
+    case NM_BOND_OPTION_TYPE_BOTH:
+        for (i = 0; option_meta->list[i]; i++) {
+            if (nm_streq(option_meta->list[i], value)) {
+                *out_value = i;
+                return TRUE;
+            }
+        }
+        /* fall-through */
+    case NM_BOND_OPTION_TYPE_INT:
+        v = _nm_utils_ascii_str_to_int64(value, 10, option_meta->min, option_meta->max, -1);
+        if (v < 0)
+            return FALSE;
+        *out_value = v;
+        return TRUE;
+    case NM_BOND_OPTION_TYPE_IP:
+    case NM_BOND_OPTION_TYPE_MAC:
+    case NM_BOND_OPTION_TYPE_IFNAME:
+        break;
+    }
+
+    return FALSE;
+}
+
 static const char *
 _bond_get_option(NMSettingBond *self, const char *option)
 {
@@ -61,7 +61,8 @@ NM_GOBJECT_PROPERTIES_DEFINE(NMDevice,
                              PROP_IP4_CONNECTIVITY,
                              PROP_IP6_CONNECTIVITY,
                              PROP_INTERFACE_FLAGS,
-                             PROP_HW_ADDRESS, );
+                             PROP_HW_ADDRESS,
+                             PROP_ACTIVATION_TIMELINE, );
 
 enum {
     STATE_CHANGED,
@@ -84,6 +85,7 @@ typedef struct _NMDevicePrivate {
     NMLDBusPropertyO  property_o[_PROPERTY_O_IDX_NUM];
     NMLDBusPropertyAO available_connections;
     GPtrArray *       lldp_neighbors;
+    GVariant *        activation_timeline;
     char *            driver;
     char *            driver_version;
     char *            hw_address;
@@ -258,6 +260,26 @@ _notify_update_prop_lldp_neighbors(NMClient *              client,
     return NML_DBUS_NOTIFY_UPDATE_PROP_FLAGS_NOTIFY;
 }
 
+static NMLDBusNotifyUpdatePropFlags
+_notify_update_prop_activation_timeline(NMClient *              client,
+                                        NMLDBusObject *         dbobj,
+                                        const NMLDBusMetaIface *meta_iface,
+                                        guint                   dbus_property_idx,
+                                        GVariant *              value)
+{
+    NMDevicePrivate *priv = NM_DEVICE_GET_PRIVATE(NM_DEVICE(dbobj->nmobj));
+
+    if (priv->activation_timeline == value
+        || (priv->activation_timeline && value
+            && g_variant_equal(priv->activation_timeline, value)))
+        return NML_DBUS_NOTIFY_UPDATE_PROP_FLAGS_NONE;
+
+    nm_clear_pointer(&priv->activation_timeline, g_variant_unref);
+    if (value)
+        priv->activation_timeline = g_variant_ref(value);
+    return NML_DBUS_NOTIFY_UPDATE_PROP_FLAGS_NOTIFY;
+}
+
 /*****************************************************************************/
 
 static NMDeviceType
@@ -323,6 +345,7 @@ finalize(GObject *object)
     NMDevicePrivate *priv = NM_DEVICE_GET_PRIVATE(object);
 
     nm_clear_pointer(&priv->lldp_neighbors, g_ptr_array_unref);
+    nm_clear_pointer(&priv->activation_timeline, g_variant_unref);
 
     g_free(priv->interface);
     g_free(priv->ip_interface);
@@ -449,6 +472,9 @@ get_property(GObject *object, guint prop_id, GValue *value, GParamSpec *pspec)
     case PROP_HW_ADDRESS:
         g_value_set_string(value, nm_device_get_hw_address(device));
         break;
+    case PROP_ACTIVATION_TIMELINE:
+        g_value_set_variant(value, nm_device_get_activation_timeline(device));
+        break;
     default:
         G_OBJECT_WARN_INVALID_PROPERTY_ID(object, prop_id, pspec);
         break;
@@ -488,6 +514,10 @@ const NMLDBusMetaIface _nml_dbus_meta_iface_nm_device = NML_DBUS_META_IFACE_INIT
     nm_device_get_type,
     NML_DBUS_META_INTERFACE_PRIO_PARENT_TYPE,
     NML_DBUS_META_IFACE_DBUS_PROPERTIES(
+        NML_DBUS_META_PROPERTY_INIT_FCN("ActivationTimeline",
+                                        PROP_ACTIVATION_TIMELINE,
+                                        "a(st)",
+                                        _notify_update_prop_activation_timeline),
         NML_DBUS_META_PROPERTY_INIT_O_PROP("ActiveConnection",
                                            PROP_ACTIVE_CONNECTION,
                                            NMDevicePrivate,
@@ -1026,6 +1056,22 @@ nm_device_class_init(NMDeviceClass *klass)
                             NULL,
                             G_PARAM_READABLE | G_PARAM_STATIC_STRINGS);
 
+    /**
+     * NMDevice:activation-timeline:
+     *
+     * The timeline of the current or last activation, as a #GVariant
+     * of type "a(st)". See nm_device_get_activation_timeline().
+     *
+     * Since: 1.30
+     **/
+    obj_properties[PROP_ACTIVATION_TIMELINE] =
+        g_param_spec_variant(NM_DEVICE_ACTIVATION_TIMELINE,
+                             "",
+                             "",
+                             G_VARIANT_TYPE("a(st)"),
+                             NULL,
+                             G_PARAM_READABLE | G_PARAM_STATIC_STRINGS);
+
     _nml_dbus_meta_class_init_with_properties(object_class, &_nml_dbus_meta_iface_nm_device);
 
     /**
@@ -1569,6 +1615,27 @@ nm_device_get_interface_flags(NMDevice *device)
     return NM_DEVICE_GET_PRIVATE(device)->interface_flags;
 }
 
+/**
+ * nm_device_get_activation_timeline:
+ * @device: a #NMDevice
+ *
+ * Gets the timeline of the current or the last activation of the device.
+ * That is an array of event names and the milliseconds since the activation
+ * was requested, in the order they happened.
+ *
+ * Returns: (transfer none) (nullable): a #GVariant of type "a(st)" or %NULL
+ *   if the daemon does not provide the timeline.
+ *
+ * Since: 1.30
+ **/
+GVariant *
+nm_device_get_activation_timeline(NMDevice *device)
+{
+    g_return_val_if_fail(NM_IS_DEVICE(device), NULL);
+
+    return NM_DEVICE_GET_PRIVATE(device)->activation_timeline;
+}
+
 /**
  * nm_device_get_state:
  * @device: a #NMDevice
@@ -324,6 +324,198 @@ set_bond_arp_ip_targets(NMDevice *device, NMSettingBond *s_bond)
         nm_setting_bond_get_option_or_default(s_bond, NM_SETTING_BOND_OPTION_ARP_IP_TARGET));
 }
 
+static gboolean
+_bond_lnk_set_option(NMDevice *device, NMPlatformLnkBond *props, const char *opt, const char *value)
+{
+    guint32 v;
+
+    if (nm_streq(opt, NM_SETTING_BOND_OPTION_PRIMARY)) {
+        const NMPlatformLink *plink;
+
+        if (!value[0]) {
+            props->primary = 0;
+            return TRUE;
+        }
+
+        /* Via netlink the primary can only be set by ifindex, while sysfs
+         * also accepts the name of a port that does not exist yet. */
+        plink = nm_platform_link_get_by_ifname(nm_device_get_platform(device), value);
+        if (!plink)
+            return FALSE;
+        props->primary = plink->ifindex;
+        return TRUE;
+    }
+
+    if (nm_streq(opt, NM_SETTING_BOND_OPTION_AD_ACTOR_SYSTEM)) {
+        NMEtherAddr addr;
+
+        if (!value[0])
+            return TRUE;
+        if (!nm_utils_hwaddr_aton(value, &addr, ETH_ALEN))
+            return FALSE;
+
+        /* kernel rejects the all-zero address, which is our default
+         * for 802.3ad. Keep the current one. */
+        if (!nm_ether_addr_equal(&addr, &nm_ether_addr_zero))
+            props->ad_actor_system = addr;
+        return TRUE;
+    }
+
+    if (!_nm_setting_bond_option_value_to_uint(opt, value, &v))
+        return FALSE;
+
+    if (nm_streq(opt, NM_SETTING_BOND_OPTION_MODE))
+        props->mode = v;
+    else if (nm_streq(opt, NM_SETTING_BOND_OPTION_MIIMON))
+        props->miimon = v;
+    else if (nm_streq(opt, NM_SETTING_BOND_OPTION_UPDELAY))
+        props->updelay = v;
+    else if (nm_streq(opt, NM_SETTING_BOND_OPTION_DOWNDELAY))
+        props->downdelay = v;
+    else if (nm_streq(opt, NM_SETTING_BOND_OPTION_USE_CARRIER))
+        props->use_carrier = !!v;
+    else if (nm_streq(opt, NM_SETTING_BOND_OPTION_ARP_INTERVAL))
+        props->arp_interval = v;
+    else if (nm_streq(opt, NM_SETTING_BOND_OPTION_ARP_VALIDATE))
+        props->arp_validate = v;
+    else if (nm_streq(opt, NM_SETTING_BOND_OPTION_ARP_ALL_TARGETS))
+        props->arp_all_targets = v;
+    else if (nm_streq(opt, NM_SETTING_BOND_OPTION_PRIMARY_RESELECT))
+        props->primary_reselect = v;
+    else if (nm_streq(opt, NM_SETTING_BOND_OPTION_FAIL_OVER_MAC))
+        props->fail_over_mac = v;
+    else if (nm_streq(opt, NM_SETTING_BOND_OPTION_XMIT_HASH_POLICY))
+        props->xmit_hash_policy = v;
+    else if (nm_streq(opt, NM_SETTING_BOND_OPTION_RESEND_IGMP))
+        props->resend_igmp = v;
+    else if (nm_streq(opt, NM_SETTING_BOND_OPTION_NUM_GRAT_ARP))
+        props->num_grat_arp = v;
+    else if (nm_streq(opt, NM_SETTING_BOND_OPTION_ALL_SLAVES_ACTIVE))
+        props->all_slaves_active = !!v;
+    else if (nm_streq(opt, NM_SETTING_BOND_OPTION_MIN_LINKS))
+        props->min_links = v;
+    else if (nm_streq(opt, NM_SETTING_BOND_OPTION_LP_INTERVAL))
+        props->lp_interval = v;
+    else if (nm_streq(opt, NM_SETTING_BOND_OPTION_PACKETS_PER_SLAVE))
+        props->packets_per_slave = v;
+    else if (nm_streq(opt, NM_SETTING_BOND_OPTION_LACP_RATE))
+        props->lacp_rate = v;
+    else if (nm_streq(opt, NM_SETTING_BOND_OPTION_AD_SELECT))
+        props->ad_select = v;
+    else if (nm_streq(opt, NM_SETTING_BOND_OPTION_AD_ACTOR_SYS_PRIO))
+        props->ad_actor_sys_prio = v;
+    else if (nm_streq(opt, NM_SETTING_BOND_OPTION_AD_USER_PORT_KEY))
+        props->ad_user_port_key = v;
+    else if (nm_streq(opt, NM_SETTING_BOND_OPTION_TLB_DYNAMIC_LB))
+        props->tlb_dynamic_lb = !!v;
+    else
+        return FALSE;
+
+    return TRUE;
+}
+
+static gboolean
+_bond_lnk_set_arp_ip_targets(NMPlatformLnkBond *props, const char *value)
+{
+    gs_free const char **strv = NULL;
+    gsize                i;
+
+    strv = nm_utils_bond_option_arp_ip_targets_split(value);
+
+    props->arp_ip_targets_num = 0;
+    for (i = 0; strv && strv[i]; i++) {
+        in_addr_t a4;
+        guint     j;
+
+        if (!nm_utils_parse_inaddr_bin(AF_INET, strv[i], NULL, &a4))
+            return FALSE;
+
+        for (j = 0; j < props->arp_ip_targets_num; j++) {
+            if (props->arp_ip_target[j] == a4)
+                break;
+        }
+        if (j < props->arp_ip_targets_num)
+            continue;
+
+        if (props->arp_ip_targets_num >= NM_BOND_MAX_ARP_TARGETS)
+            return FALSE;
+        props->arp_ip_target[props->arp_ip_targets_num++] = a4;
+    }
+
+    return TRUE;
+}
+
+/*
+ * Sets the bond options @attr_v and the ARP targets with one netlink
+ * request. Only the options that differ from what kernel reports are
+ * sent. Returns %FALSE if that is not possible, in which case the caller
+ * falls back to setting the options one by one via sysfs.
+ */
+static gboolean
+commit_bond_options(NMDevice *device, NMSettingBond *s_bond, const char *const *attr_v)
+{
+    NMDeviceBond *               self    = NM_DEVICE_BOND(device);
+    NMPlatform *                 plat    = nm_device_get_platform(device);
+    int                          ifindex = nm_device_get_ifindex(device);
+    gs_unref_ptrarray GPtrArray *sysfs_opts = NULL;
+    const NMPlatformLnkBond *    lnk;
+    NMPlatformLnkBond            props;
+    const char *                 value;
+    guint                        i;
+    int                          r;
+
+    lnk = nm_platform_link_get_lnk_bond(plat, ifindex, NULL);
+    if (!lnk)
+        return FALSE;
+
+    props = *lnk;
+
+    for (; *attr_v; attr_v++) {
+        const char *opt = *attr_v;
+
+        value = nm_setting_bond_get_option_or_default(s_bond, opt);
+        if (!value) {
+            if (_LOGT_ENABLED(LOGD_BOND) && nm_setting_bond_get_option_by_name(s_bond, opt))
+                _LOGT(LOGD_BOND, "bond option '%s' not set as it conflicts with other options", opt);
+            continue;
+        }
+
+        if (!_bond_lnk_set_option(device, &props, opt, value)) {
+            if (!sysfs_opts)
+                sysfs_opts = g_ptr_array_new();
+            g_ptr_array_add(sysfs_opts, (gpointer) opt);
+        }
+    }
+
+    value = nm_setting_bond_get_option_or_default(s_bond, NM_SETTING_BOND_OPTION_ARP_IP_TARGET);
+    if (value && !_bond_lnk_set_arp_ip_targets(&props, value))
+        return FALSE;
+
+    /* Kernel rejects a request that enables both ARP and MII monitoring,
+     * while via sysfs setting arp_interval implicitly disables miimon. */
+    if (props.arp_interval > 0)
+        props.miimon = 0;
+
+    /* updelay and downdelay cannot be set while MII monitoring is off. */
+    if (props.miimon == 0) {
+        props.updelay   = lnk->updelay;
+        props.downdelay = lnk->downdelay;
+    }
+
+    r = nm_platform_link_bond_change(plat, ifindex, &props);
+    if (r < 0) {
+        _LOGD(LOGD_BOND, "failed to set bond options via netlink: %s", nm_strerror(r));
+        return FALSE;
+    }
+
+    if (sysfs_opts) {
+        for (i = 0; i < sysfs_opts->len; i++)
+            set_bond_attr_or_default(device, s_bond, sysfs_opts->pdata[i]);
+    }
+
+    return TRUE;
+}
+
 static gboolean
 apply_bonding_config(NMDeviceBond *self)
 {
@@ -339,6 +531,11 @@ apply_bonding_config(NMDeviceBond *self)
     mode     = _nm_setting_bond_mode_from_string(mode_str);
     g_return_val_if_fail(mode != NM_BOND_MODE_UNKNOWN, FALSE);
 
+    if (commit_bond_options(device,
+                            s_bond,
+                            NM_MAKE_STRV(NM_SETTING_BOND_OPTION_MODE, OPTIONS_APPLY_SUBSET)))
+        return TRUE;
+
     /* Set mode first, as some other options (e.g. arp_interval) are valid
      * only for certain modes.
      */
@@ -551,6 +748,9 @@ reapply_connection(NMDevice *device, NMConnection *con_old, NMConnection *con_ne
     /* Below we set only the bond options that kernel allows to modify
      * while keeping the bond interface up */
 
+    if (commit_bond_options(device, s_bond, NM_MAKE_STRV(OPTIONS_REAPPLY_SUBSET)))
+        return;
+
     set_bond_arp_ip_targets(device, s_bond);
 
     set_bond_attrs_or_default(device, s_bond, NM_MAKE_STRV(OPTIONS_REAPPLY_SUBSET));
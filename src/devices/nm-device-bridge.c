@@ -432,6 +432,45 @@ static const Option slave_options[] = {
     OPTION(NM_SETTING_BRIDGE_PORT_HAIRPIN_MODE, "hairpin_mode", OPTION_TYPE_BOOL(FALSE), ),
     {0}};
 
+static void
+_platform_lnk_bridge_init_from_setting(NMSettingBridge *s_bridge, NMPlatformLnkBridge *props)
+{
+    *props = (NMPlatformLnkBridge){
+        .forward_delay = _DEFAULT_IF_ZERO(nm_setting_bridge_get_forward_delay(s_bridge) * 100u,
+                                          NM_BRIDGE_FORWARD_DELAY_DEF_SYS),
+        .hello_time    = _DEFAULT_IF_ZERO(nm_setting_bridge_get_hello_time(s_bridge) * 100u,
+                                       NM_BRIDGE_HELLO_TIME_DEF_SYS),
+        .max_age       = _DEFAULT_IF_ZERO(nm_setting_bridge_get_max_age(s_bridge) * 100u,
+                                    NM_BRIDGE_MAX_AGE_DEF_SYS),
+        .ageing_time   = _DEFAULT_IF_ZERO(nm_setting_bridge_get_ageing_time(s_bridge) * 100u,
+                                        NM_BRIDGE_AGEING_TIME_DEF_SYS),
+        .stp_state     = nm_setting_bridge_get_stp(s_bridge),
+        .priority      = nm_setting_bridge_get_priority(s_bridge),
+        .vlan_protocol = to_sysfs_vlan_protocol_sys(nm_setting_bridge_get_vlan_protocol(s_bridge)),
+        .vlan_stats_enabled = nm_setting_bridge_get_vlan_stats_enabled(s_bridge),
+        .group_fwd_mask     = nm_setting_bridge_get_group_forward_mask(s_bridge),
+        .mcast_snooping     = nm_setting_bridge_get_multicast_snooping(s_bridge),
+        .mcast_router =
+            to_sysfs_multicast_router_sys(nm_setting_bridge_get_multicast_router(s_bridge)),
+        .mcast_query_use_ifaddr    = nm_setting_bridge_get_multicast_query_use_ifaddr(s_bridge),
+        .mcast_querier             = nm_setting_bridge_get_multicast_querier(s_bridge),
+        .mcast_hash_max            = nm_setting_bridge_get_multicast_hash_max(s_bridge),
+        .mcast_last_member_count   = nm_setting_bridge_get_multicast_last_member_count(s_bridge),
+        .mcast_startup_query_count = nm_setting_bridge_get_multicast_startup_query_count(s_bridge),
+        .mcast_last_member_interval =
+            nm_setting_bridge_get_multicast_last_member_interval(s_bridge),
+        .mcast_membership_interval = nm_setting_bridge_get_multicast_membership_interval(s_bridge),
+        .mcast_querier_interval    = nm_setting_bridge_get_multicast_querier_interval(s_bridge),
+        .mcast_query_interval      = nm_setting_bridge_get_multicast_query_interval(s_bridge),
+        .mcast_query_response_interval =
+            nm_setting_bridge_get_multicast_query_response_interval(s_bridge),
+        .mcast_startup_query_interval =
+            nm_setting_bridge_get_multicast_startup_query_interval(s_bridge),
+    };
+
+    to_sysfs_group_address_sys(nm_setting_bridge_get_group_address(s_bridge), &props->group_addr);
+}
+
 static void
 commit_option(NMDevice *device, NMSetting *setting, const Option *option, gboolean slave)
 {
@@ -523,50 +562,80 @@ out:
 }
 
 static const NMPlatformBridgeVlan **
-setting_vlans_to_platform(GPtrArray *array)
+setting_vlans_to_platform(GPtrArray *array, guint16 default_pvid)
 {
     NMPlatformBridgeVlan **arr;
     NMPlatformBridgeVlan * p_data;
+    guint                  len;
     guint                  i;
+    guint                  j = 0;
 
-    if (!array || !array->len)
+    len = (array ? array->len : 0u) + (default_pvid ? 1u : 0u);
+    if (len == 0)
         return NULL;
 
     G_STATIC_ASSERT_EXPR(_nm_alignof(NMPlatformBridgeVlan *) >= _nm_alignof(NMPlatformBridgeVlan));
-    arr    = g_malloc((sizeof(NMPlatformBridgeVlan *) * (array->len + 1))
-                   + (sizeof(NMPlatformBridgeVlan) * (array->len)));
-    p_data = (NMPlatformBridgeVlan *) &arr[array->len + 1];
+    arr    = g_malloc((sizeof(NMPlatformBridgeVlan *) * (len + 1))
+                   + (sizeof(NMPlatformBridgeVlan) * len));
+    p_data = (NMPlatformBridgeVlan *) &arr[len + 1];
+
+    if (default_pvid) {
+        /* The VLAN that kernel creates for the "default_pvid" option. Entries
+         * from @array that follow may override it. */
+        p_data[j] = (NMPlatformBridgeVlan){
+            .vid_start = default_pvid,
+            .vid_end   = default_pvid,
+            .pvid      = TRUE,
+            .untagged  = TRUE,
+        };
+        arr[j] = &p_data[j];
+        j++;
+    }
 
-    for (i = 0; i < array->len; i++) {
+    for (i = 0; array && i < array->len; i++, j++) {
         NMBridgeVlan *vlan = array->pdata[i];
         guint16       vid_start, vid_end;
 
         nm_bridge_vlan_get_vid_range(vlan, &vid_start, &vid_end);
 
-        p_data[i] = (NMPlatformBridgeVlan){
+        p_data[j] = (NMPlatformBridgeVlan){
             .vid_start = vid_start,
             .vid_end   = vid_end,
             .pvid      = nm_bridge_vlan_is_pvid(vlan),
             .untagged  = nm_bridge_vlan_is_untagged(vlan),
         };
-        arr[i] = &p_data[i];
+        arr[j] = &p_data[j];
     }
-    arr[i] = NULL;
+    arr[j] = NULL;
     return (const NMPlatformBridgeVlan **) arr;
 }
 
 static void
 commit_slave_options(NMDevice *device, NMSettingBridgePort *setting)
 {
-    const Option *  option;
-    NMSetting *     s;
+    const Option *       option;
+    NMSetting *          s;
     gs_unref_object NMSetting *s_clear = NULL;
+    NMPlatformBridgePort       port;
 
     if (setting)
         s = NM_SETTING(setting);
     else
         s = s_clear = nm_setting_bridge_port_new();
 
+    port = (NMPlatformBridgePort){
+        .priority     = _DEFAULT_IF_ZERO(nm_setting_bridge_port_get_priority((NMSettingBridgePort *) s),
+                                     NM_BRIDGE_PORT_PRIORITY_DEF),
+        .path_cost    = _DEFAULT_IF_ZERO(nm_setting_bridge_port_get_path_cost((NMSettingBridgePort *) s),
+                                      NM_BRIDGE_PORT_PATH_COST_DEF),
+        .hairpin_mode = nm_setting_bridge_port_get_hairpin_mode((NMSettingBridgePort *) s),
+    };
+
+    if (nm_platform_link_set_bridge_port(nm_device_get_platform(device),
+                                         nm_device_get_ifindex(device),
+                                         &port))
+        return;
+
     for (option = slave_options; option->name; option++)
         commit_option(device, s, option, TRUE);
 }
@@ -741,8 +810,9 @@ bridge_set_vlan_options(NMDevice *device, NMSettingBridge *s_bridge)
     guint16           pvid;
     NMPlatform *      plat;
     int               ifindex;
-    gs_unref_ptrarray GPtrArray *vlans              = NULL;
-    gs_free const NMPlatformBridgeVlan **plat_vlans = NULL;
+    gs_unref_ptrarray GPtrArray *vlans                = NULL;
+    gs_free const NMPlatformBridgeVlan **plat_vlans   = NULL;
+    gs_free char *                       cur_pvid_str = NULL;
 
     if (self->vlan_configured)
         return TRUE;
@@ -768,35 +838,29 @@ bridge_set_vlan_options(NMDevice *device, NMSettingBridge *s_bridge)
 
     self->vlan_configured = TRUE;
 
-    /* Filtering must be disabled to change the default PVID */
-    if (!nm_platform_sysctl_master_set_option(plat, ifindex, "vlan_filtering", "0"))
-        return FALSE;
-
-    /* Clear the default PVID so that we later can force the re-creation of
-     * default PVID VLANs by writing the option again. */
-    if (!nm_platform_sysctl_master_set_option(plat, ifindex, "default_pvid", "0"))
-        return FALSE;
-
-    /* Clear all existing VLANs */
-    if (!nm_platform_link_set_bridge_vlans(plat, ifindex, FALSE, NULL))
-        return FALSE;
-
-    /* Now set the default PVID. After this point the kernel creates
-     * a PVID VLAN on each port, including the bridge itself. */
     pvid = nm_setting_bridge_get_vlan_default_pvid(s_bridge);
-    if (pvid) {
+
+    cur_pvid_str = nm_platform_sysctl_master_get_option(plat, ifindex, "default_pvid");
+    if (_nm_utils_ascii_str_to_int64(cur_pvid_str, 10, 0, 4094, -1) != pvid) {
         char value[32];
 
+        /* Filtering must be disabled to change the default PVID. After this
+         * point the kernel moves the PVID VLAN of each port, including the
+         * bridge itself, to the new default PVID. */
+        if (!nm_platform_sysctl_master_set_option(plat, ifindex, "vlan_filtering", "0"))
+            return FALSE;
+
         nm_sprintf_buf(value, "%u", pvid);
         if (!nm_platform_sysctl_master_set_option(plat, ifindex, "default_pvid", value))
             return FALSE;
     }
 
-    /* Create VLANs only after setting the default PVID, so that
-     * any PVID VLAN overrides the bridge's default PVID. */
+    /* Only add and remove the VLANs that differ from the current state. The
+     * VLAN for the default PVID is listed first, so that any PVID VLAN from
+     * the setting overrides it. */
     g_object_get(s_bridge, NM_SETTING_BRIDGE_VLANS, &vlans, NULL);
-    plat_vlans = setting_vlans_to_platform(vlans);
-    if (plat_vlans && !nm_platform_link_set_bridge_vlans(plat, ifindex, FALSE, plat_vlans))
+    plat_vlans = setting_vlans_to_platform(vlans, pvid);
+    if (!nm_platform_link_sync_bridge_vlans(plat, ifindex, FALSE, plat_vlans))
         return FALSE;
 
     if (!nm_platform_sysctl_master_set_option(plat, ifindex, "vlan_filtering", "1"))
@@ -808,9 +872,12 @@ bridge_set_vlan_options(NMDevice *device, NMSettingBridge *s_bridge)
 static NMActStageReturn
 act_stage1_prepare(NMDevice *device, NMDeviceStateReason *out_failure_reason)
 {
-    NMConnection *connection;
-    NMSetting *   s_bridge;
-    const Option *option;
+    NMDeviceBridge *    self = NM_DEVICE_BRIDGE(device);
+    NMConnection *      connection;
+    NMSetting *         s_bridge;
+    const Option *      option;
+    NMPlatformLnkBridge props;
+    int                 r;
 
     connection = nm_device_get_applied_connection(device);
     g_return_val_if_fail(connection, NM_ACT_STAGE_RETURN_FAILURE);
@@ -818,8 +885,18 @@ act_stage1_prepare(NMDevice *device, NMDeviceStateReason *out_failure_reason)
     s_bridge = (NMSetting *) nm_connection_get_setting_bridge(connection);
     g_return_val_if_fail(s_bridge, NM_ACT_STAGE_RETURN_FAILURE);
 
-    for (option = master_options; option->name; option++)
-        commit_option(device, s_bridge, option, FALSE);
+    /* Set all options with one netlink request. Only what differs from
+     * the current state of the bridge is sent. */
+    _platform_lnk_bridge_init_from_setting((NMSettingBridge *) s_bridge, &props);
+    props.priority = _DEFAULT_IF_ZERO(props.priority, NM_BRIDGE_PRIORITY_DEF);
+    r = nm_platform_link_bridge_change(nm_device_get_platform(device),
+                                       nm_device_get_ifindex(device),
+                                       &props);
+    if (r < 0) {
+        _LOGD(LOGD_BRIDGE, "failed to set bridge options via netlink: %s", nm_strerror(r));
+        for (option = master_options; option->name; option++)
+            commit_option(device, s_bridge, option, FALSE);
+    }
 
     if (!bridge_set_vlan_options(device, (NMSettingBridge *) s_bridge)) {
         NM_SET_OUT(out_failure_reason, NM_DEVICE_STATE_REASON_CONFIG_FAILED);
@@ -961,7 +1038,7 @@ enslave_slave(NMDevice *device, NMDevice *slave, NMConnection *connection, gbool
             if (s_port)
                 g_object_get(s_port, NM_SETTING_BRIDGE_PORT_VLANS, &vlans, NULL);
 
-            plat_vlans = setting_vlans_to_platform(vlans);
+            plat_vlans = setting_vlans_to_platform(vlans, 0);
 
             /* Since the link was just enslaved, there are no existing VLANs
              * (except for the default one) and so there's no need to flush. */
@@ -1068,40 +1145,7 @@ create_and_realize(NMDevice *             device,
         }
     }
 
-    props = (NMPlatformLnkBridge){
-        .forward_delay = _DEFAULT_IF_ZERO(nm_setting_bridge_get_forward_delay(s_bridge) * 100u,
-                                          NM_BRIDGE_FORWARD_DELAY_DEF_SYS),
-        .hello_time    = _DEFAULT_IF_ZERO(nm_setting_bridge_get_hello_time(s_bridge) * 100u,
-                                       NM_BRIDGE_HELLO_TIME_DEF_SYS),
-        .max_age       = _DEFAULT_IF_ZERO(nm_setting_bridge_get_max_age(s_bridge) * 100u,
-                                    NM_BRIDGE_MAX_AGE_DEF_SYS),
-        .ageing_time   = _DEFAULT_IF_ZERO(nm_setting_bridge_get_ageing_time(s_bridge) * 100u,
-                                        NM_BRIDGE_AGEING_TIME_DEF_SYS),
-        .stp_state     = nm_setting_bridge_get_stp(s_bridge),
-        .priority      = nm_setting_bridge_get_priority(s_bridge),
-        .vlan_protocol = to_sysfs_vlan_protocol_sys(nm_setting_bridge_get_vlan_protocol(s_bridge)),
-        .vlan_stats_enabled = nm_setting_bridge_get_vlan_stats_enabled(s_bridge),
-        .group_fwd_mask     = nm_setting_bridge_get_group_forward_mask(s_bridge),
-        .mcast_snooping     = nm_setting_bridge_get_multicast_snooping(s_bridge),
-        .mcast_router =
-            to_sysfs_multicast_router_sys(nm_setting_bridge_get_multicast_router(s_bridge)),
-        .mcast_query_use_ifaddr    = nm_setting_bridge_get_multicast_query_use_ifaddr(s_bridge),
-        .mcast_querier             = nm_setting_bridge_get_multicast_querier(s_bridge),
-        .mcast_hash_max            = nm_setting_bridge_get_multicast_hash_max(s_bridge),
-        .mcast_last_member_count   = nm_setting_bridge_get_multicast_last_member_count(s_bridge),
-        .mcast_startup_query_count = nm_setting_bridge_get_multicast_startup_query_count(s_bridge),
-        .mcast_last_member_interval =
-            nm_setting_bridge_get_multicast_last_member_interval(s_bridge),
-        .mcast_membership_interval = nm_setting_bridge_get_multicast_membership_interval(s_bridge),
-        .mcast_querier_interval    = nm_setting_bridge_get_multicast_querier_interval(s_bridge),
-        .mcast_query_interval      = nm_setting_bridge_get_multicast_query_interval(s_bridge),
-        .mcast_query_response_interval =
-            nm_setting_bridge_get_multicast_query_response_interval(s_bridge),
-        .mcast_startup_query_interval =
-            nm_setting_bridge_get_multicast_startup_query_interval(s_bridge),
-    };
-
-    to_sysfs_group_address_sys(nm_setting_bridge_get_group_address(s_bridge), &props.group_addr);
+    _platform_lnk_bridge_init_from_setting(s_bridge, &props);
 
     /* If mtu != 0, we set the MTU of the new bridge at creation time. However, kernel will still
      * automatically adjust the MTU of the bridge based on the minimum of the slave's MTU.
@@ -643,6 +643,7 @@ supplicant_iface_state_is_completed(NMDeviceEthernet *self, NMSupplicantInterfac
          * schedule the next activation stage.
          */
         if (nm_device_get_state(NM_DEVICE(self)) == NM_DEVICE_STATE_CONFIG) {
+            nm_device_activation_timeline_add(NM_DEVICE(self), "supplicant-completed");
             _LOGI(LOGD_DEVICE | LOGD_ETHER,
                   "Activation: (ethernet) Stage 2 of 5 (Device Configure) successful.");
             nm_device_activate_schedule_stage3_ip_config_start(NM_DEVICE(self));
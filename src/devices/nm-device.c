@@ -285,7 +285,8 @@ NM_GOBJECT_PROPERTIES_DEFINE(NMDevice,
                              PROP_STATISTICS_RX_BYTES,
                              PROP_IP4_CONNECTIVITY,
                              PROP_IP6_CONNECTIVITY,
-                             PROP_INTERFACE_FLAGS, );
+                             PROP_INTERFACE_FLAGS,
+                             PROP_ACTIVATION_TIMELINE, );
 
 typedef struct _NMDevicePrivate {
     bool in_state_changed;
@@ -675,6 +676,13 @@ typedef struct _NMDevicePrivate {
     guint   check_delete_unrealized_id;
     guint32 interface_flags;
 
+    struct {
+        /* of ActivationTimelineEvent, for the current or last activation. */
+        GArray *events;
+        gint64  start_msec;
+        bool    recording : 1;
+    } activation_timeline;
+
     struct {
         SriovOp *pending; /* SR-IOV operation currently running */
         SriovOp *next;    /* next SR-IOV operation scheduled */
@@ -2769,6 +2777,79 @@ _add_capabilities(NMDevice *self, NMDeviceCapabilities capabilities)
 
 /*****************************************************************************/
 
+#define ACTIVATION_TIMELINE_MAX_EVENTS 64
+
+typedef struct {
+    const char *event;
+    gint64      msec;
+} ActivationTimelineEvent;
+
+/**
+ * nm_device_activation_timeline_add:
+ * @self: the #NMDevice
+ * @event: (transfer none): a static string naming the event.
+ *
+ * Records @event with the current timestamp in the timeline of the ongoing
+ * activation. The timeline is exposed on D-Bus and gets emitted on the
+ * next state change. Does nothing if the device is not activating.
+ */
+void
+nm_device_activation_timeline_add(NMDevice *self, const char *event)
+{
+    NMDevicePrivate *        priv = NM_DEVICE_GET_PRIVATE(self);
+    ActivationTimelineEvent *e;
+
+    if (!priv->activation_timeline.recording
+        || priv->activation_timeline.events->len >= ACTIVATION_TIMELINE_MAX_EVENTS)
+        return;
+
+    e        = nm_g_array_append_new(priv->activation_timeline.events, ActivationTimelineEvent);
+    e->event = event;
+    e->msec  = nm_utils_get_monotonic_timestamp_msec() - priv->activation_timeline.start_msec;
+
+    _LOGT(LOGD_DEVICE, "activation-timeline: %s at +%" G_GINT64_FORMAT " msec", event, e->msec);
+}
+
+static void
+_activation_timeline_start(NMDevice *self, NMActRequest *req)
+{
+    NMDevicePrivate *priv = NM_DEVICE_GET_PRIVATE(self);
+
+    if (!priv->activation_timeline.events) {
+        priv->activation_timeline.events =
+            g_array_sized_new(FALSE, FALSE, sizeof(ActivationTimelineEvent), 16);
+    } else
+        g_array_set_size(priv->activation_timeline.events, 0);
+
+    priv->activation_timeline.start_msec = nm_act_request_get_created_msec(req);
+    priv->activation_timeline.recording  = TRUE;
+
+    nm_device_activation_timeline_add(self, "activate");
+    _notify(self, PROP_ACTIVATION_TIMELINE);
+}
+
+static GVariant *
+_activation_timeline_to_variant(NMDevice *self)
+{
+    NMDevicePrivate *priv = NM_DEVICE_GET_PRIVATE(self);
+    GVariantBuilder  builder;
+    guint            i;
+
+    g_variant_builder_init(&builder, G_VARIANT_TYPE("a(st)"));
+    if (priv->activation_timeline.events) {
+        for (i = 0; i < priv->activation_timeline.events->len; i++) {
+            const ActivationTimelineEvent *e = &g_array_index(priv->activation_timeline.events,
+                                                              ActivationTimelineEvent,
+                                                              i);
+
+            g_variant_builder_add(&builder, "(st)", e->event, (guint64) MAX(e->msec, 0));
+        }
+    }
+    return g_variant_builder_end(&builder);
+}
+
+/*****************************************************************************/
+
 static NM_UTILS_LOOKUP_STR_DEFINE(_ip_state_to_string,
                                   NMDeviceIPState,
                                   NM_UTILS_LOOKUP_DEFAULT_WARN("unknown"),
@@ -2797,6 +2878,11 @@ _set_ip_state(NMDevice *self, int addr_family, NMDeviceIPState new_state)
 
     priv->ip_state_x_[IS_IPv4] = new_state;
 
+    if (new_state == NM_DEVICE_IP_STATE_DONE)
+        nm_device_activation_timeline_add(self, IS_IPv4 ? "ip4-done" : "ip6-done");
+    else if (new_state == NM_DEVICE_IP_STATE_FAIL)
+        nm_device_activation_timeline_add(self, IS_IPv4 ? "ip4-fail" : "ip6-fail");
+
     if (new_state == NM_DEVICE_IP_STATE_DONE) {
         /* we only set the IPx_READY flag once we reach NM_DEVICE_IP_STATE_DONE state. We don't
          * ever clear it, even if we later enter NM_DEVICE_IP_STATE_FAIL state.
@@ -5471,13 +5557,17 @@ link_changed_cb(NMPlatform *    platform,
         if (!(info->n_ifi_flags & IFF_UP))
             priv->device_link_changed_down = TRUE;
         if (!priv->device_link_changed_id) {
-            priv->device_link_changed_id = g_idle_add((GSourceFunc) device_link_changed, self);
+            priv->device_link_changed_id = nm_idle_class_add(NM_IDLE_CLASS_LINK_CHANGED,
+                                                             (GSourceFunc) device_link_changed,
+                                                             self);
             _LOGD(LOGD_DEVICE, "queued link change for ifindex %d", ifindex);
         }
     } else if (ifindex == nm_device_get_ip_ifindex(self)) {
         if (!priv->device_ip_link_changed_id) {
             priv->device_ip_link_changed_id =
-                g_idle_add((GSourceFunc) device_ip_link_changed, self);
+                nm_idle_class_add(NM_IDLE_CLASS_LINK_CHANGED,
+                                  (GSourceFunc) device_ip_link_changed,
+                                  self);
             _LOGD(LOGD_DEVICE, "queued link change for ip-ifindex %d", ifindex);
         }
     }
@@ -7768,8 +7858,10 @@ activation_source_schedule(NMDevice *self, ActivationHandleFunc func, int addr_f
         return;
     }
 
-    new_id =
-        g_idle_add(IS_IPv4 ? activation_source_handle_cb_4 : activation_source_handle_cb_6, self);
+    new_id = nm_idle_class_add(NM_IDLE_CLASS_ACTIVATION_STAGE,
+                               IS_IPv4 ? activation_source_handle_cb_4
+                                       : activation_source_handle_cb_6,
+                               self);
 
     if (priv->activation_source_id_x[IS_IPv4] != 0) {
         _LOGD(LOGD_DEVICE,
@@ -9261,6 +9353,8 @@ dhcp4_state_changed(NMDhcpClient *client,
             break;
         }
 
+        nm_device_activation_timeline_add(self, "dhcp4-lease");
+
         nm_clear_g_source(&priv->dhcp_data_4.grace_id);
         priv->dhcp_data_4.grace_pending = FALSE;
 
@@ -9680,6 +9774,7 @@ dhcp6_state_changed(NMDhcpClient *client,
     switch (state) {
     case NM_DHCP_STATE_BOUND:
     case NM_DHCP_STATE_EXTENDED:
+        nm_device_activation_timeline_add(self, "dhcp6-lease");
         nm_clear_g_source(&priv->dhcp_data_6.grace_id);
         priv->dhcp_data_6.grace_pending = FALSE;
         /* If the server sends multiple IPv6 addresses, we receive a state
@@ -11254,6 +11349,7 @@ nm_device_activate_stage3_ip_start(NMDevice *self, int addr_family)
     }
 
     _set_ip_state(self, addr_family, NM_DEVICE_IP_STATE_CONF);
+    nm_device_activation_timeline_add(self, IS_IPv4 ? "ip4-start" : "ip6-start");
 
     ret = NM_DEVICE_GET_CLASS(self)->act_stage3_ip_config_start(self,
                                                                 addr_family,
@@ -13151,6 +13247,8 @@ _device_activate(NMDevice *self, NMActRequest *req)
 
     act_request_set(self, req);
 
+    _activation_timeline_start(self, req);
+
     nm_device_activate_schedule_stage1_device_prepare(self, FALSE);
 }
 
@@ -13450,6 +13548,9 @@ nm_device_set_ip_config(NMDevice *  self,
             if (!_rt6_temporary_not_available_set(self, temporary_not_available))
                 success = FALSE;
         }
+
+        if (success)
+            nm_device_activation_timeline_add(self, IS_IPv4 ? "ip4-commit" : "ip6-commit");
     }
 
     old_config = priv->ip_config_x[IS_IPv4];
@@ -13662,6 +13763,8 @@ dispatcher_complete_proceed_state(NMDispatcherCallId *call_id, gpointer user_dat
     g_return_if_fail(call_id == priv->dispatcher.call_id);
 
     priv->dispatcher.call_id = NULL;
+    if (priv->dispatcher.post_state == NM_DEVICE_STATE_SECONDARIES)
+        nm_device_activation_timeline_add(self, "dispatcher-pre-up-done");
     nm_device_queue_state(self, priv->dispatcher.post_state, priv->dispatcher.post_state_reason);
     priv->dispatcher.post_state        = NM_DEVICE_STATE_UNKNOWN;
     priv->dispatcher.post_state_reason = NM_DEVICE_STATE_REASON_NONE;
@@ -13679,6 +13782,7 @@ ip_check_pre_up(NMDevice *self)
 
     priv->dispatcher.post_state        = NM_DEVICE_STATE_SECONDARIES;
     priv->dispatcher.post_state_reason = NM_DEVICE_STATE_REASON_NONE;
+    nm_device_activation_timeline_add(self, "dispatcher-pre-up");
     if (!nm_dispatcher_call_device(NM_DISPATCHER_ACTION_PRE_UP,
                                    self,
                                    NULL,
@@ -14389,6 +14493,7 @@ queued_ip_config_change(NMDevice *self, int addr_family)
             && !nm_ip6_config_has_any_dad_pending(priv->ext_ip6_config_captured,
                                                   priv->dad6_ip6_config)) {
             _LOGD(LOGD_DEVICE | LOGD_IP6, "IPv6 DAD terminated");
+            nm_device_activation_timeline_add(self, "ip6-dad-done");
             g_clear_object(&priv->dad6_ip6_config);
             _set_ip_state(self, addr_family, NM_DEVICE_IP_STATE_DONE);
             check_ip_state(self, FALSE, TRUE);
@@ -14444,7 +14549,8 @@ device_ipx_changed(NMPlatform *  platform,
     case NMP_OBJECT_TYPE_IP4_ADDRESS:
     case NMP_OBJECT_TYPE_IP4_ROUTE:
         if (!priv->queued_ip_config_id_4) {
-            priv->queued_ip_config_id_4 = g_idle_add(queued_ip4_config_change, self);
+            priv->queued_ip_config_id_4 =
+                nm_idle_class_add(NM_IDLE_CLASS_IP_CONFIG, queued_ip4_config_change, self);
             _LOGD(LOGD_DEVICE, "queued IP4 config change");
         }
         break;
@@ -14461,7 +14567,8 @@ device_ipx_changed(NMPlatform *  platform,
         /* fall-through */
     case NMP_OBJECT_TYPE_IP6_ROUTE:
         if (!priv->queued_ip_config_id_6) {
-            priv->queued_ip_config_id_6 = g_idle_add(queued_ip6_config_change, self);
+            priv->queued_ip_config_id_6 =
+                nm_idle_class_add(NM_IDLE_CLASS_IP_CONFIG, queued_ip6_config_change, self);
             _LOGD(LOGD_DEVICE, "queued IP6 config change");
         }
         break;
@@ -14725,8 +14832,10 @@ _set_unmanaged_flags(NMDevice *          self,
         /* trigger an initial update of IP configuration. */
         nm_assert_se(!nm_clear_g_source(&priv->queued_ip_config_id_4));
         nm_assert_se(!nm_clear_g_source(&priv->queued_ip_config_id_6));
-        priv->queued_ip_config_id_4 = g_idle_add(queued_ip4_config_change, self);
-        priv->queued_ip_config_id_6 = g_idle_add(queued_ip6_config_change, self);
+        priv->queued_ip_config_id_4 =
+            nm_idle_class_add(NM_IDLE_CLASS_IP_CONFIG, queued_ip4_config_change, self);
+        priv->queued_ip_config_id_6 =
+            nm_idle_class_add(NM_IDLE_CLASS_IP_CONFIG, queued_ip6_config_change, self);
 
         if (!priv->pending_actions) {
             do_notify_has_pending_actions = TRUE;
@@ -16251,6 +16360,7 @@ _set_state_full(NMDevice *self, NMDeviceState state, NMDeviceStateReason reason,
     NMSettingsConnection *        sett_conn;
     NMSettingSriov *              s_sriov;
     gboolean                      concheck_now;
+    gboolean                      timeline_changed = FALSE;
 
     g_return_if_fail(NM_IS_DEVICE(self));
 
@@ -16299,6 +16409,14 @@ _set_state_full(NMDevice *self, NMDeviceState state, NMDeviceStateReason reason,
     priv->state        = state;
     priv->state_reason = reason;
 
+    if (priv->activation_timeline.recording) {
+        nm_device_activation_timeline_add(self, nm_device_state_to_str(state));
+        /* stop recording once the activation is complete, failed or aborted. */
+        if (state >= NM_DEVICE_STATE_ACTIVATED || state <= NM_DEVICE_STATE_DISCONNECTED)
+            priv->activation_timeline.recording = FALSE;
+        timeline_changed = TRUE;
+    }
+
     queued_state_clear(self);
 
     dispatcher_cleanup(self);
@@ -16429,6 +16547,8 @@ _set_state_full(NMDevice *self, NMDeviceState state, NMDeviceStateReason reason,
 
     _notify(self, PROP_STATE);
     _notify(self, PROP_STATE_REASON);
+    if (timeline_changed)
+        _notify(self, PROP_ACTIVATION_TIMELINE);
     nm_dbus_object_emit_signal(NM_DBUS_OBJECT(self),
                                &interface_info_device,
                                &signal_info_state_changed,
@@ -17403,15 +17523,22 @@ nm_device_spec_match_list(NMDevice *self, const GSList *specs)
     return nm_device_spec_match_list_full(self, specs, FALSE);
 }
 
-int
-nm_device_spec_match_list_full(NMDevice *self, const GSList *specs, int no_match_value)
+/**
+ * nm_device_get_match_spec_data:
+ * @self: the #NMDevice
+ * @out_data: (out): the properties of @self that device match specs
+ *   can match on. The strings are owned by @self (or the DHCP manager)
+ *   and must not be kept beyond the current call.
+ */
+void
+nm_device_get_match_spec_data(NMDevice *self, NMMatchSpecDeviceData *out_data)
 {
-    NMDeviceClass *      klass;
-    NMMatchSpecMatchType m;
-    const char *         hw_address = NULL;
-    gboolean             is_fake;
+    NMDeviceClass *klass;
+    const char *   hw_address;
+    gboolean       is_fake;
 
-    g_return_val_if_fail(NM_IS_DEVICE(self), FALSE);
+    nm_assert(NM_IS_DEVICE(self));
+    nm_assert(out_data);
 
     klass      = NM_DEVICE_GET_CLASS(self);
     hw_address = nm_device_get_permanent_hw_address_full(
@@ -17419,14 +17546,35 @@ nm_device_spec_match_list_full(NMDevice *self, const GSList *specs, int no_match
         !nm_device_get_unmanaged_flags(self, NM_UNMANAGED_PLATFORM_INIT),
         &is_fake);
 
+    *out_data = (NMMatchSpecDeviceData){
+        .interface_name   = nm_device_get_iface(self),
+        .device_type      = nm_device_get_type_description(self),
+        .driver           = nm_device_get_driver(self),
+        .driver_version   = nm_device_get_driver_version(self),
+        .hwaddr           = is_fake ? NULL : hw_address,
+        .s390_subchannels = klass->get_s390_subchannels ? klass->get_s390_subchannels(self) : NULL,
+        .dhcp_plugin      = nm_dhcp_manager_get_config(nm_dhcp_manager_get()),
+    };
+}
+
+int
+nm_device_spec_match_list_full(NMDevice *self, const GSList *specs, int no_match_value)
+{
+    NMMatchSpecMatchType  m;
+    NMMatchSpecDeviceData data;
+
+    g_return_val_if_fail(NM_IS_DEVICE(self), FALSE);
+
+    nm_device_get_match_spec_data(self, &data);
+
     m = nm_match_spec_device(specs,
-                             nm_device_get_iface(self),
-                             nm_device_get_type_description(self),
-                             nm_device_get_driver(self),
-                             nm_device_get_driver_version(self),
-                             is_fake ? NULL : hw_address,
-                             klass->get_s390_subchannels ? klass->get_s390_subchannels(self) : NULL,
-                             nm_dhcp_manager_get_config(nm_dhcp_manager_get()));
+                             data.interface_name,
+                             data.device_type,
+                             data.driver,
+                             data.driver_version,
+                             data.hwaddr,
+                             data.s390_subchannels,
+                             data.dhcp_plugin);
 
     switch (m) {
     case NM_MATCH_SPEC_MATCH:
@@ -17880,6 +18028,9 @@ get_property(GObject *object, guint prop_id, GValue *value, GParamSpec *pspec)
     case PROP_REAL:
         g_value_set_boolean(value, nm_device_is_real(self));
         break;
+    case PROP_ACTIVATION_TIMELINE:
+        g_value_take_variant(value, _activation_timeline_to_variant(self));
+        break;
     case PROP_SLAVES:
     {
         CList *slave_iter;
@@ -18285,6 +18436,7 @@ finalize(GObject *object)
 
     g_hash_table_unref(priv->ip6_saved_properties);
     g_hash_table_unref(priv->available_connections);
+    nm_clear_pointer(&priv->activation_timeline.events, g_array_unref);
 
     nm_dbus_track_obj_path_deinit(&priv->parent_device);
     nm_dbus_track_obj_path_deinit(&priv->act_request);
@@ -18415,7 +18567,10 @@ static const NMDBusInterfaceInfoExtended interface_info_device = {
                                                            NM_DEVICE_INTERFACE_FLAGS),
             NM_DEFINE_DBUS_PROPERTY_INFO_EXTENDED_READABLE("HwAddress",
                                                            "s",
-                                                           NM_DEVICE_HW_ADDRESS), ), ),
+                                                           NM_DEVICE_HW_ADDRESS),
+            NM_DEFINE_DBUS_PROPERTY_INFO_EXTENDED_READABLE("ActivationTimeline",
+                                                           "a(st)",
+                                                           NM_DEVICE_ACTIVATION_TIMELINE), ), ),
 };
 
 const NMDBusInterfaceInfoExtended nm_interface_info_device_statistics = {
@@ -18767,6 +18922,13 @@ nm_device_class_init(NMDeviceClass *klass)
                           G_MAXUINT32,
                           0,
                           G_PARAM_READABLE | G_PARAM_STATIC_STRINGS);
+    obj_properties[PROP_ACTIVATION_TIMELINE] =
+        g_param_spec_variant(NM_DEVICE_ACTIVATION_TIMELINE,
+                             "",
+                             "",
+                             G_VARIANT_TYPE("a(st)"),
+                             NULL,
+                             G_PARAM_READABLE | G_PARAM_STATIC_STRINGS);
 
     g_object_class_install_properties(object_class, _PROPERTY_ENUMS_LAST, obj_properties);
 
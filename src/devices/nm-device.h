@@ -97,9 +97,10 @@ nm_device_state_reason_check(NMDeviceStateReason reason)
  * and NMDeviceWifi. */
 #define NM_DEVICE_PERM_HW_ADDRESS "perm-hw-address"
 
-#define NM_DEVICE_METERED        "metered"
-#define NM_DEVICE_LLDP_NEIGHBORS "lldp-neighbors"
-#define NM_DEVICE_REAL           "real"
+#define NM_DEVICE_METERED             "metered"
+#define NM_DEVICE_LLDP_NEIGHBORS      "lldp-neighbors"
+#define NM_DEVICE_REAL                "real"
+#define NM_DEVICE_ACTIVATION_TIMELINE "activation-timeline"
 
 /* "parent" is exposed on D-Bus by subclasses like NMDeviceIPTunnel */
 #define NM_DEVICE_PARENT "parent"
@@ -574,6 +575,7 @@ gboolean nm_device_check_slave_connection_compatible(NMDevice *device, NMConnect
 
 gboolean nm_device_unmanage_on_quit(NMDevice *self);
 
+void     nm_device_get_match_spec_data(NMDevice *self, NMMatchSpecDeviceData *out_data);
 gboolean nm_device_spec_match_list(NMDevice *device, const GSList *specs);
 int      nm_device_spec_match_list_full(NMDevice *self, const GSList *specs, int no_match_value);
 
@@ -864,6 +866,8 @@ struct _NMBtVTableNetworkServer {
 const char *nm_device_state_to_str(NMDeviceState state);
 const char *nm_device_state_reason_to_str(NMDeviceStateReason reason);
 
+void nm_device_activation_timeline_add(NMDevice *self, const char *event);
+
 gboolean nm_device_is_vpn(NMDevice *self);
 
 const char *
@@ -35,6 +35,10 @@ typedef struct {
     GHashTable *lldp_neighbors;
     GVariant *  variant;
 
+    /* the same neighbors as in @lldp_neighbors, but indexed by their raw
+     * LLDPDU. This allows to detect unchanged neighbors without parsing them. */
+    GHashTable *lldp_neighbors_by_raw;
+
     /* the timestamp in nsec until which we delay updates. */
     gint64 ratelimit_next_nsec;
     guint  ratelimit_id;
@@ -69,6 +73,11 @@ typedef struct {
 
 /*****************************************************************************/
 
+static gboolean
+process_lldp_neighbor(NMLldpListener *self, sd_lldp_neighbor *neighbor_sd, gboolean remove);
+
+/*****************************************************************************/
+
 #define _NMLOG_PREFIX_NAME "lldp"
 #define _NMLOG_DOMAIN      LOGD_DEVICE
 #define _NMLOG(level, ...)                                                                      \
@@ -258,6 +267,21 @@ lldp_neighbor_freep(LldpNeighbor **ptr)
     lldp_neighbor_free(*ptr);
 }
 
+static guint
+lldp_neighbor_raw_hash(gconstpointer ptr)
+{
+    LldpNeighbor *neigh = (LldpNeighbor *) ptr;
+    const guint8 *raw_data;
+    gsize         raw_len;
+    NMHashState   h;
+
+    lldp_neighbor_get_raw(neigh, &raw_data, &raw_len);
+
+    nm_hash_init(&h, 3497627461u);
+    nm_hash_update_mem(&h, raw_data, raw_len);
+    return nm_hash_complete(&h);
+}
+
 static gboolean
 lldp_neighbor_equal(LldpNeighbor *a, LldpNeighbor *b)
 {
@@ -274,6 +298,12 @@ lldp_neighbor_equal(LldpNeighbor *a, LldpNeighbor *b)
     return raw_len_a == raw_len_b && (memcmp(raw_data_a, raw_data_b, raw_len_a) == 0);
 }
 
+static gboolean
+lldp_neighbor_raw_equal(gconstpointer a, gconstpointer b)
+{
+    return lldp_neighbor_equal((LldpNeighbor *) a, (LldpNeighbor *) b);
+}
+
 static GVariant *
 parse_management_address_tlv(const uint8_t *data, gsize len)
 {
@@ -806,6 +836,21 @@ nmtst_lldp_parse_from_raw(const guint8 *raw_data, gsize raw_len)
     return g_variant_ref(variant);
 }
 
+gboolean
+nmtst_lldp_listener_process_raw(NMLldpListener *self, const guint8 *raw_data, gsize raw_len)
+{
+    nm_auto(sd_lldp_neighbor_unrefp) sd_lldp_neighbor *neighbor_sd = NULL;
+    int                                                r;
+
+    g_assert(raw_data);
+    g_assert(raw_len > 0);
+
+    r = sd_lldp_neighbor_from_raw(&neighbor_sd, raw_data, raw_len);
+    g_assert(r >= 0);
+
+    return process_lldp_neighbor(self, neighbor_sd, FALSE);
+}
+
 /*****************************************************************************/
 
 static void
@@ -854,26 +899,39 @@ data_changed_schedule(NMLldpListener *self)
     priv->ratelimit_id = g_idle_add_full(G_PRIORITY_LOW, data_changed_timeout, self, NULL);
 }
 
-static void
+/* Returns: %FALSE if the LLDPDU is identical to that of a known neighbor and
+ * parsing it was skipped. */
+static gboolean
 process_lldp_neighbor(NMLldpListener *self, sd_lldp_neighbor *neighbor_sd, gboolean remove)
 {
     NMLldpListenerPrivate *                    priv;
     nm_auto(lldp_neighbor_freep) LldpNeighbor *neigh = NULL;
     LldpNeighbor *                             neigh_old;
 
-    g_return_if_fail(NM_IS_LLDP_LISTENER(self));
+    g_return_val_if_fail(NM_IS_LLDP_LISTENER(self), FALSE);
 
     priv = NM_LLDP_LISTENER_GET_PRIVATE(self);
 
-    g_return_if_fail(priv->lldp_handle);
-    g_return_if_fail(neighbor_sd);
+    g_return_val_if_fail(priv->lldp_handle, FALSE);
+    g_return_val_if_fail(neighbor_sd, FALSE);
 
     nm_assert(priv->lldp_neighbors);
 
+    if (!remove) {
+        LldpNeighbor needle = {
+            .neighbor_sd = neighbor_sd,
+        };
+
+        /* Fast path: most frames are periodic refreshes with an identical LLDPDU.
+         * Compare the raw data, before parsing the neighbor. */
+        if (g_hash_table_contains(priv->lldp_neighbors_by_raw, &needle))
+            return FALSE;
+    }
+
     neigh = lldp_neighbor_new(neighbor_sd);
     if (!neigh) {
         _LOGT("process: failed to parse neighbor");
-        return;
+        return TRUE;
     }
 
     neigh_old = g_hash_table_lookup(priv->lldp_neighbors, neigh);
@@ -882,21 +940,28 @@ process_lldp_neighbor(NMLldpListener *self, sd_lldp_neighbor *neighbor_sd, gbool
         if (neigh_old) {
             _LOGT("process: %s neigh: " LOG_NEIGH_FMT, "remove", LOG_NEIGH_ARG(neigh));
 
+            g_hash_table_remove(priv->lldp_neighbors_by_raw, neigh_old);
             g_hash_table_remove(priv->lldp_neighbors, neigh_old);
             goto handle_changed;
         }
-        return;
+        return TRUE;
     }
 
     if (neigh_old && lldp_neighbor_equal(neigh_old, neigh))
-        return;
+        return TRUE;
 
     _LOGD("process: %s neigh: " LOG_NEIGH_FMT, neigh_old ? "update" : "new", LOG_NEIGH_ARG(neigh));
 
+    /* the new neighbor replaces (and frees) @neigh_old. Unlink it from the
+     * raw index first. The serialized variants of the other neighbors stay cached. */
+    if (neigh_old)
+        g_hash_table_remove(priv->lldp_neighbors_by_raw, neigh_old);
+    g_hash_table_add(priv->lldp_neighbors_by_raw, neigh);
     g_hash_table_add(priv->lldp_neighbors, g_steal_pointer(&neigh));
 
 handle_changed:
     data_changed_schedule(self);
+    return TRUE;
 }
 
 static void
@@ -970,6 +1035,8 @@ nm_lldp_listener_start(NMLldpListener *self, int ifindex, GError **error)
                                                  lldp_neighbor_id_equal,
                                                  (GDestroyNotify) lldp_neighbor_free,
                                                  NULL);
+    priv->lldp_neighbors_by_raw =
+        g_hash_table_new(lldp_neighbor_raw_hash, lldp_neighbor_raw_equal);
 
     _LOGD("start");
 
@@ -1002,6 +1069,7 @@ nm_lldp_listener_stop(NMLldpListener *self)
         priv->lldp_handle = NULL;
 
         size = g_hash_table_size(priv->lldp_neighbors);
+        nm_clear_pointer(&priv->lldp_neighbors_by_raw, g_hash_table_unref);
         g_hash_table_remove_all(priv->lldp_neighbors);
         nm_clear_pointer(&priv->lldp_neighbors, g_hash_table_unref);
         if (size > 0 || priv->ratelimit_id != 0)
@@ -1264,6 +1264,60 @@ TEST_RECV_FRAME_DEFINE(
     0x00, /* ethernet trailer */
 );
 
+static void
+test_parse_frames_benchmark(TestRecvFixture *fixture, gconstpointer test_data)
+{
+    const TestRecvFrame *           frame    = test_data;
+    gs_unref_object NMLldpListener *listener = NULL;
+    GVariant *                      v_neighbors;
+    const guint                     N     = 10000;
+    GError *                        error = NULL;
+    gint64                          start_ns;
+    gint64                          full_ns;
+    gint64                          fast_ns;
+    guint                           i;
+
+    if (fixture->ifindex == 0) {
+        g_test_skip("Tun device not available");
+        return;
+    }
+
+    listener = nm_lldp_listener_new();
+    g_assert(nm_lldp_listener_start(listener, fixture->ifindex, &error));
+    g_assert_no_error(error);
+
+    /* the first frame introduces a new neighbor, and must be parsed. */
+    g_assert(nmtst_lldp_listener_process_raw(listener, frame->frame, frame->frame_len));
+
+    /* periodic refreshes with the same LLDPDU take the fast path, and are
+     * never parsed again. */
+    start_ns = nm_utils_get_monotonic_timestamp_nsec();
+    for (i = 0; i < N; i++)
+        g_assert(!nmtst_lldp_listener_process_raw(listener, frame->frame, frame->frame_len));
+    fast_ns = nm_utils_get_monotonic_timestamp_nsec() - start_ns;
+
+    v_neighbors = nm_lldp_listener_get_neighbors(listener);
+    g_assert_cmpint(g_variant_n_children(v_neighbors), ==, 1);
+
+    /* compare with fully parsing and serializing the neighbor each time. */
+    start_ns = nm_utils_get_monotonic_timestamp_nsec();
+    for (i = 0; i < N; i++) {
+        gs_unref_variant GVariant *v_neighbor = NULL;
+
+        v_neighbor = nmtst_lldp_parse_from_raw(frame->frame, frame->frame_len);
+        g_assert(v_neighbor);
+    }
+    full_ns = nm_utils_get_monotonic_timestamp_nsec() - start_ns;
+
+    g_test_message("processed %u LLDPDUs of %u bytes: %.3f msec (unchanged), %.3f msec (parsed)",
+                   N,
+                   (guint) frame->frame_len,
+                   (double) fast_ns / 1000000.0,
+                   (double) full_ns / 1000000.0);
+
+    nm_lldp_listener_stop(listener);
+}
+
 /*****************************************************************************/
 
 NMTstpSetupFunc const _nmtstp_setup_platform_func = nm_linux_platform_setup;
@@ -1293,4 +1347,10 @@ _nmtstp_setup_tests(void)
     g_test_add_data_func("/lldp/parse-frames/1", &_test_recv_data1_frame0, test_parse_frames);
     g_test_add_data_func("/lldp/parse-frames/2", &_test_recv_data2_frame0_ttl1, test_parse_frames);
     g_test_add_data_func("/lldp/parse-frames/3", &_test_parse_frames_3, test_parse_frames);
+    g_test_add("/lldp/parse-frames/benchmark",
+               TestRecvFixture,
+               &_test_recv_data1_frame0,
+               _test_recv_fixture_setup,
+               test_parse_frames_benchmark,
+               _test_recv_fixture_teardown);
 }
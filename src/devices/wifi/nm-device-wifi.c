@@ -106,6 +106,10 @@ typedef struct {
 
     guint ap_dump_id;
 
+    /* coalesces the notifications and rechecks for APs that appear
+     * and disappear during a scan. */
+    guint ap_list_changed_id;
+
     guint periodic_update_id;
 
     guint link_timeout_id;
@@ -133,6 +137,7 @@ typedef struct {
     bool scan_explicit_requested : 1;
     bool ssid_found : 1;
     bool hidden_probe_scan_warn : 1;
+    bool ap_list_changed_recheck_available : 1;
 
 } NMDeviceWifiPrivate;
 
@@ -785,10 +790,33 @@ periodic_update_cb(gpointer user_data)
 }
 
 static void
-ap_add_remove(NMDeviceWifi *self,
-              gboolean      is_adding, /* or else removing */
-              NMWifiAP *    ap,
-              gboolean      recheck_available_connections)
+_ap_list_changed(NMDeviceWifi *self, gboolean recheck_available_connections)
+{
+    _notify(self, PROP_ACCESS_POINTS);
+
+    nm_device_emit_recheck_auto_activate(NM_DEVICE(self));
+    if (recheck_available_connections)
+        nm_device_recheck_available_connections(NM_DEVICE(self));
+}
+
+static gboolean
+_ap_list_changed_cb(gpointer user_data)
+{
+    NMDeviceWifi *       self = user_data;
+    NMDeviceWifiPrivate *priv = NM_DEVICE_WIFI_GET_PRIVATE(self);
+    gboolean             recheck_available_connections;
+
+    recheck_available_connections           = priv->ap_list_changed_recheck_available;
+    priv->ap_list_changed_recheck_available = FALSE;
+    priv->ap_list_changed_id                = 0;
+    _ap_list_changed(self, recheck_available_connections);
+    return G_SOURCE_REMOVE;
+}
+
+static void
+_ap_add_remove_link(NMDeviceWifi *self,
+                    gboolean      is_adding, /* or else removing */
+                    NMWifiAP *    ap)
 {
     NMDeviceWifiPrivate *priv = NM_DEVICE_WIFI_GET_PRIVATE(self);
 
@@ -810,18 +838,36 @@ ap_add_remove(NMDeviceWifi *self,
                                  nm_wifi_ap_get_supplicant_path(ap)))
             nm_assert_not_reached();
         _ap_dump(self, LOGL_DEBUG, ap, "removed", 0);
-    }
-
-    _notify(self, PROP_ACCESS_POINTS);
-
-    if (!is_adding) {
         nm_device_wifi_emit_signal_access_point(NM_DEVICE(self), ap, FALSE);
         nm_dbus_object_clear_and_unexport(&ap);
     }
+}
 
-    nm_device_emit_recheck_auto_activate(NM_DEVICE(self));
-    if (recheck_available_connections)
-        nm_device_recheck_available_connections(NM_DEVICE(self));
+static void
+ap_add_remove(NMDeviceWifi *self,
+              gboolean      is_adding, /* or else removing */
+              NMWifiAP *    ap,
+              gboolean      recheck_available_connections)
+{
+    _ap_add_remove_link(self, is_adding, ap);
+    _ap_list_changed(self, recheck_available_connections);
+}
+
+/* Like ap_add_remove(), but the property notification and the rechecks
+ * are coalesced on an idle handler. With hundreds of BSSs in a scan,
+ * doing them for each AP makes every scan result quadratic. */
+static void
+ap_add_remove_deferred(NMDeviceWifi *self,
+                       gboolean      is_adding, /* or else removing */
+                       NMWifiAP *    ap)
+{
+    NMDeviceWifiPrivate *priv = NM_DEVICE_WIFI_GET_PRIVATE(self);
+
+    _ap_add_remove_link(self, is_adding, ap);
+
+    priv->ap_list_changed_recheck_available = TRUE;
+    if (!priv->ap_list_changed_id)
+        priv->ap_list_changed_id = g_idle_add(_ap_list_changed_cb, self);
 }
 
 static void
@@ -1944,7 +1990,7 @@ supplicant_iface_bss_changed_cb(NMSupplicantInterface *iface,
             if (nm_wifi_ap_set_fake(found_ap, TRUE))
                 _ap_dump(self, LOGL_DEBUG, found_ap, "updated", 0);
         } else {
-            ap_add_remove(self, FALSE, found_ap, TRUE);
+            ap_add_remove_deferred(self, FALSE, found_ap);
             schedule_ap_list_dump(self);
         }
         return;
@@ -1987,7 +2033,7 @@ supplicant_iface_bss_changed_cb(NMSupplicantInterface *iface,
             }
         }
 
-        ap_add_remove(self, TRUE, ap, TRUE);
+        ap_add_remove_deferred(self, TRUE, ap);
     }
 
     /* Update the current AP if the supplicant notified a current BSS change
@@ -2461,6 +2507,8 @@ supplicant_iface_state(NMDeviceWifi *             self,
             ssid = nm_setting_wireless_get_ssid(s_wifi);
             g_return_if_fail(ssid);
 
+            nm_device_activation_timeline_add(device, "supplicant-completed");
+
             _LOGI(LOGD_DEVICE | LOGD_WIFI,
                   "Activation: (wifi) Stage 2 of 5 (Device Configure) successful. %s %s",
                   priv->mode == NM_802_11_MODE_AP ? "Started Wi-Fi Hotspot"
@@ -3715,6 +3763,7 @@ dispose(GObject *object)
     nm_assert(c_list_is_empty(&priv->scanning_prohibited_lst_head));
 
     nm_clear_g_source(&priv->periodic_update_id);
+    nm_clear_g_source(&priv->ap_list_changed_id);
 
     wifi_secrets_cancel(self);
 
@@ -28,6 +28,11 @@ typedef struct {
     const NMDhcpClientFactory *client_factory;
     char *                     default_hostname;
     CList                      dhcp_client_lst_head;
+
+    /* Index of the clients in @dhcp_client_lst_head by ifindex, per
+     * address family. The ifindex of a client is construct-only, so
+     * the key never changes while the client is linked. */
+    GHashTable *dhcp_client_idx[2];
 } NMDhcpManagerPrivate;
 
 struct _NMDhcpManager {
@@ -157,21 +162,46 @@ get_client_for_ifindex(NMDhcpManager *manager, int addr_family, int ifindex)
 
     priv = NM_DHCP_MANAGER_GET_PRIVATE(manager);
 
-    c_list_for_each_entry (client, &priv->dhcp_client_lst_head, dhcp_client_lst) {
-        if (nm_dhcp_client_get_ifindex(client) == ifindex
-            && nm_dhcp_client_get_addr_family(client) == addr_family)
-            return client;
-    }
+    client = g_hash_table_lookup(priv->dhcp_client_idx[NM_IS_IPv4(addr_family)],
+                                 GINT_TO_POINTER(ifindex));
 
-    return NULL;
+    nm_assert(!client
+              || (nm_dhcp_client_get_ifindex(client) == ifindex
+                  && nm_dhcp_client_get_addr_family(client) == addr_family));
+    return client;
+}
+
+static void
+add_client(NMDhcpManager *self, NMDhcpClient *client)
+{
+    NMDhcpManagerPrivate *priv = NM_DHCP_MANAGER_GET_PRIVATE(self);
+    GHashTable *          idx;
+
+    idx = priv->dhcp_client_idx[NM_IS_IPv4(nm_dhcp_client_get_addr_family(client))];
+
+    nm_assert(client && c_list_is_empty(&client->dhcp_client_lst));
+    nm_assert(!g_hash_table_contains(idx,
+                                     GINT_TO_POINTER(nm_dhcp_client_get_ifindex(client))));
+
+    c_list_link_tail(&priv->dhcp_client_lst_head, &client->dhcp_client_lst);
+    g_hash_table_insert(idx, GINT_TO_POINTER(nm_dhcp_client_get_ifindex(client)), client);
 }
 
 static void
 remove_client(NMDhcpManager *self, NMDhcpClient *client)
 {
+    NMDhcpManagerPrivate *priv = NM_DHCP_MANAGER_GET_PRIVATE(self);
+    GHashTable *          idx;
+    gpointer              key;
+
     g_signal_handlers_disconnect_by_func(client, client_state_changed, self);
     c_list_unlink(&client->dhcp_client_lst);
 
+    idx = priv->dhcp_client_idx[NM_IS_IPv4(nm_dhcp_client_get_addr_family(client))];
+    key = GINT_TO_POINTER(nm_dhcp_client_get_ifindex(client));
+    if (g_hash_table_lookup(idx, key) == client)
+        g_hash_table_remove(idx, key);
+
     /* Stopping the client is left up to the controlling device
      * explicitly since we may want to quit NetworkManager but not terminate
      * the DHCP client.
@@ -337,8 +367,7 @@ client_start(NMDhcpManager *           self,
                           (guint)(0 | (hostname_use_fqdn ? NM_DHCP_CLIENT_FLAGS_USE_FQDN : 0)
                                   | (info_only ? NM_DHCP_CLIENT_FLAGS_INFO_ONLY : 0)),
                           NULL);
-    nm_assert(client && c_list_is_empty(&client->dhcp_client_lst));
-    c_list_link_tail(&priv->dhcp_client_lst_head, &client->dhcp_client_lst);
+    add_client(self, client);
     g_signal_connect(client,
                      NM_DHCP_CLIENT_SIGNAL_STATE_CHANGED,
                      G_CALLBACK(client_state_changed),
@@ -581,6 +610,24 @@ nmtst_dhcp_manager_unget(gpointer self)
     _nmtst_nm_dhcp_manager_get_reset(self);
 }
 
+NMDhcpClient *
+nmtst_dhcp_manager_get_client(NMDhcpManager *self, int addr_family, int ifindex)
+{
+    return get_client_for_ifindex(self, addr_family, ifindex);
+}
+
+void
+nmtst_dhcp_manager_add_client(NMDhcpManager *self, NMDhcpClient *client)
+{
+    add_client(self, g_object_ref(client));
+}
+
+void
+nmtst_dhcp_manager_remove_client(NMDhcpManager *self, NMDhcpClient *client)
+{
+    remove_client_unref(self, client);
+}
+
 static void
 nm_dhcp_manager_init(NMDhcpManager *self)
 {
@@ -592,6 +639,8 @@ nm_dhcp_manager_init(NMDhcpManager *self)
     const NMDhcpClientFactory *client_factory = NULL;
 
     c_list_init(&priv->dhcp_client_lst_head);
+    priv->dhcp_client_idx[0] = g_hash_table_new(nm_direct_hash, NULL);
+    priv->dhcp_client_idx[1] = g_hash_table_new(nm_direct_hash, NULL);
 
     for (i = 0; i < G_N_ELEMENTS(_nm_dhcp_manager_factories); i++) {
         const NMDhcpClientFactory *f = _nm_dhcp_manager_factories[i];
@@ -670,6 +719,8 @@ dispose(GObject *object)
 
     G_OBJECT_CLASS(nm_dhcp_manager_parent_class)->dispose(object);
 
+    nm_clear_pointer(&priv->dhcp_client_idx[0], g_hash_table_unref);
+    nm_clear_pointer(&priv->dhcp_client_idx[1], g_hash_table_unref);
     nm_clear_g_free(&priv->default_hostname);
 }
 
@@ -84,4 +84,8 @@ extern const NMDhcpClientFactory *const _nm_dhcp_manager_factories[6];
 
 void nmtst_dhcp_manager_unget(gpointer singleton_instance);
 
+NMDhcpClient *nmtst_dhcp_manager_get_client(NMDhcpManager *self, int addr_family, int ifindex);
+void          nmtst_dhcp_manager_add_client(NMDhcpManager *self, NMDhcpClient *client);
+void          nmtst_dhcp_manager_remove_client(NMDhcpManager *self, NMDhcpClient *client);
+
 #endif /* __NETWORKMANAGER_DHCP_MANAGER_H__ */
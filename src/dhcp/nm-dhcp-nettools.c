@@ -53,6 +53,7 @@ typedef struct {
     NDhcp4ClientLease *lease;
     GSource *          event_source;
     char *             lease_file;
+    bool               is_probing : 1;
 } NMDhcpNettoolsPrivate;
 
 struct _NMDhcpNettools {
@@ -71,6 +72,35 @@ G_DEFINE_TYPE(NMDhcpNettools, nm_dhcp_nettools, NM_TYPE_DHCP_CLIENT)
 
 /*****************************************************************************/
 
+/* The number of clients in this process that are still waiting for their
+ * first lease. Used to spread out the initial DISCOVER of many clients that
+ * start at the same time. */
+static guint _n_probing = 0;
+
+static void
+_probing_set(NMDhcpNettoolsPrivate *priv, gboolean is_probing)
+{
+    if (priv->is_probing == (!!is_probing))
+        return;
+
+    priv->is_probing = is_probing;
+    if (is_probing)
+        _n_probing++;
+    else {
+        nm_assert(_n_probing > 0);
+        _n_probing--;
+    }
+}
+
+static void
+_probe_clear(NMDhcpNettoolsPrivate *priv)
+{
+    _probing_set(priv, FALSE);
+    priv->probe = n_dhcp4_client_probe_free(priv->probe);
+}
+
+/*****************************************************************************/
+
 static void
 set_error_nettools(GError **error, int r, const char *message)
 {
@@ -1093,9 +1123,11 @@ dhcp4_event_handle(NMDhcpNettools *self, NDhcp4ClientEvent *event)
         nm_dhcp_client_set_state(NM_DHCP_CLIENT(self), NM_DHCP_STATE_EXPIRE, NULL, NULL);
         break;
     case N_DHCP4_CLIENT_EVENT_CANCELLED:
+        _probing_set(priv, FALSE);
         nm_dhcp_client_set_state(NM_DHCP_CLIENT(self), NM_DHCP_STATE_FAIL, NULL, NULL);
         break;
     case N_DHCP4_CLIENT_EVENT_GRANTED:
+        _probing_set(priv, FALSE);
         priv->lease = n_dhcp4_client_lease_ref(event->granted.lease);
         bound4_handle(self, event->granted.lease, FALSE);
         break;
@@ -1145,6 +1177,7 @@ dhcp4_event_cb(int fd, GIOCondition condition, gpointer data)
          */
         _LOGE("error %d dispatching events", r);
         nm_clear_g_source_inst(&priv->event_source);
+        _probing_set(priv, FALSE);
         nm_dhcp_client_set_state(NM_DHCP_CLIENT(self), NM_DHCP_STATE_FAIL, NULL, NULL);
         return G_SOURCE_REMOVE;
     }
@@ -1340,11 +1373,8 @@ ip4_start(NMDhcpClient *client,
         return FALSE;
     }
 
-    /*
-     * FIXME:
-     * Select, or configure, a reasonable start delay, to protect poor servers being flooded.
-     */
-    n_dhcp4_client_probe_config_set_start_delay(config, 1);
+    n_dhcp4_client_probe_config_set_start_delay(config,
+                                                nm_dhcp_utils_get_start_delay_msec(_n_probing));
 
     nm_dhcp_utils_get_leasefile_path(AF_INET,
                                      "internal",
@@ -1472,6 +1502,7 @@ ip4_start(NMDhcpClient *client,
         set_error_nettools(error, r, "failed to start DHCP client");
         return FALSE;
     }
+    _probing_set(priv, TRUE);
 
     _LOGT("dhcp-client4: start %p", (gpointer) priv->client);
 
@@ -1489,7 +1520,7 @@ stop(NMDhcpClient *client, gboolean release)
 
     _LOGT("dhcp-client4: stop %p", (gpointer) priv->client);
 
-    priv->probe = n_dhcp4_client_probe_free(priv->probe);
+    _probe_clear(priv);
 }
 
 /*****************************************************************************/
@@ -1506,7 +1537,7 @@ dispose(GObject *object)
     nm_clear_g_free(&priv->lease_file);
     nm_clear_g_source_inst(&priv->event_source);
     nm_clear_pointer(&priv->lease, n_dhcp4_client_lease_unref);
-    nm_clear_pointer(&priv->probe, n_dhcp4_client_probe_free);
+    _probe_clear(priv);
     nm_clear_pointer(&priv->client, n_dhcp4_client_unref);
 
     G_OBJECT_CLASS(nm_dhcp_nettools_parent_class)->dispose(object);
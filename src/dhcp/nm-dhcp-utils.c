@@ -815,6 +815,30 @@ nm_dhcp_utils_get_leasefile_path(int         addr_family,
     return FALSE;
 }
 
+#define START_DELAY_MSEC_PER_CLIENT 2u
+#define START_DELAY_MSEC_MAX        2000u
+
+/**
+ * nm_dhcp_utils_get_start_delay_msec:
+ * @n_running_clients: the number of DHCP clients that are currently waiting
+ *   for their first lease.
+ *
+ * The client picks a random delay in the range [0, start_delay) before sending
+ * the first DISCOVER. With only a few clients there is no need to wait. When many
+ * interfaces request a lease at once (for example, hundreds of macvlans at boot),
+ * widen the window so that we don't flood the server (and our own main loop) with
+ * a burst of DISCOVER messages.
+ *
+ * Returns: the start delay in milliseconds.
+ */
+guint64
+nm_dhcp_utils_get_start_delay_msec(guint n_running_clients)
+{
+    return NM_CLAMP((guint64) n_running_clients * START_DELAY_MSEC_PER_CLIENT,
+                    (guint64) 1u,
+                    (guint64) START_DELAY_MSEC_MAX);
+}
+
 char *
 nm_dhcp_utils_get_dhcp6_event_id(GHashTable *lease)
 {
@@ -40,4 +40,6 @@ char **nm_dhcp_parse_search_list(guint8 *data, size_t n_data);
 
 char *nm_dhcp_utils_get_dhcp6_event_id(GHashTable *lease);
 
+guint64 nm_dhcp_utils_get_start_delay_msec(guint n_running_clients);
+
 #endif /* __NETWORKMANAGER_DHCP_UTILS_H__ */
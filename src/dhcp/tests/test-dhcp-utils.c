@@ -13,7 +13,10 @@
 #include "nm-utils.h"
 
 #include "dhcp/nm-dhcp-utils.h"
+#include "dhcp/nm-dhcp-client.h"
+#include "dhcp/nm-dhcp-manager.h"
 #include "platform/nm-platform.h"
+#include "nm-config.h"
 
 #include "nm-test-utils-core.h"
 
@@ -740,6 +743,156 @@ test_client_id_from_string(void)
     COMPARE_ID(endcolon, TRUE, endcolon, strlen(endcolon));
 }
 
+/*****************************************************************************/
+
+static void
+test_start_delay(void)
+{
+    guint64 prev = 0;
+    guint   n;
+
+    /* with no or a few clients running, don't delay the initial DISCOVER. */
+    g_assert_cmpint(nm_dhcp_utils_get_start_delay_msec(0), ==, 1);
+    g_assert_cmpint(nm_dhcp_utils_get_start_delay_msec(1), ==, 2);
+    g_assert_cmpint(nm_dhcp_utils_get_start_delay_msec(10), ==, 20);
+
+    /* the window grows with the number of running clients... */
+    for (n = 0; n < 5000; n++) {
+        guint64 delay = nm_dhcp_utils_get_start_delay_msec(n);
+
+        g_assert_cmpint(delay, >=, prev);
+        g_assert_cmpint(delay, >=, 1);
+        g_assert_cmpint(delay, <=, 2000);
+        prev = delay;
+    }
+
+    /* ...but is capped, so that the last clients still start in time. */
+    g_assert_cmpint(nm_dhcp_utils_get_start_delay_msec(1000), ==, 2000);
+    g_assert_cmpint(nm_dhcp_utils_get_start_delay_msec(G_MAXUINT), ==, 2000);
+
+    /* 500 clients starting at once get spread over a window of one second. */
+    g_assert_cmpint(nm_dhcp_utils_get_start_delay_msec(500), ==, 1000);
+}
+
+/*****************************************************************************/
+
+static NMConfig *
+_setup_config(void)
+{
+    char *                  argv[] = {"test-dhcp-utils",
+                     "--config",
+                     "/dev/null",
+                     "--intern-config",
+                     "",
+                     "--config-dir",
+                     "/no/such/dir",
+                     "--system-config-dir",
+                     "",
+                     NULL};
+    char **                 argv_p = argv;
+    int                     argc   = G_N_ELEMENTS(argv) - 1;
+    NMConfigCmdLineOptions *cli;
+    GOptionContext *        context;
+    NMConfig *              config;
+    GError *                error = NULL;
+
+    cli     = nm_config_cmd_line_options_new(FALSE);
+    context = g_option_context_new(NULL);
+    nm_config_cmd_line_options_add_to_entries(cli, context);
+    g_assert(g_option_context_parse(context, &argc, &argv_p, NULL));
+    g_option_context_free(context);
+
+    config = nm_config_setup(cli, NULL, &error);
+    g_assert_no_error(error);
+    g_assert(config);
+    nm_config_cmd_line_options_free(cli);
+    return config;
+}
+
+static NMDhcpClient *
+_client_new(NMDedupMultiIndex *multi_idx, int addr_family, int ifindex)
+{
+    gs_free char *iface = g_strdup_printf("mv%d", ifindex);
+
+    return g_object_new(_nm_dhcp_client_factory_internal.get_type_per_addr_family(addr_family),
+                        NM_DHCP_CLIENT_MULTI_IDX,
+                        multi_idx,
+                        NM_DHCP_CLIENT_ADDR_FAMILY,
+                        addr_family,
+                        NM_DHCP_CLIENT_INTERFACE,
+                        iface,
+                        NM_DHCP_CLIENT_IFINDEX,
+                        ifindex,
+                        NM_DHCP_CLIENT_UUID,
+                        "4d7c5d5c-8a3c-4e8b-8b6a-0f0c1f0e0b2a",
+                        NULL);
+}
+
+static void
+test_manager_client_idx(void)
+{
+    nm_auto_unref_dedup_multi_index NMDedupMultiIndex *multi_idx = nm_dedup_multi_index_new();
+    gs_unref_object NMConfig *config                             = NULL;
+    NMDhcpManager *                                    dhcp_manager;
+    gpointer                                           logging_old_state;
+    NMDhcpClient *                                     clients[2][300];
+    const int                                          N = G_N_ELEMENTS(clients[0]);
+    int                                                IS_IPv4;
+    int                                                i;
+
+    config = _setup_config();
+
+    logging_old_state = nmtst_logging_disable(FALSE);
+    dhcp_manager      = nm_dhcp_manager_get();
+    nmtst_logging_reenable(logging_old_state);
+
+    for (i = 0; i < N; i++) {
+        for (IS_IPv4 = 0; IS_IPv4 < 2; IS_IPv4++) {
+            clients[IS_IPv4][i] = _client_new(multi_idx, IS_IPv4 ? AF_INET : AF_INET6, i + 1);
+            nmtst_dhcp_manager_add_client(dhcp_manager, clients[IS_IPv4][i]);
+        }
+    }
+
+    /* every client is found by its ifindex, and the address families don't mix. */
+    for (i = 0; i < N; i++) {
+        for (IS_IPv4 = 0; IS_IPv4 < 2; IS_IPv4++) {
+            g_assert(nmtst_dhcp_manager_get_client(dhcp_manager,
+                                                   IS_IPv4 ? AF_INET : AF_INET6,
+                                                   i + 1)
+                     == clients[IS_IPv4][i]);
+        }
+    }
+    g_assert(!nmtst_dhcp_manager_get_client(dhcp_manager, AF_INET, N + 1));
+    g_assert(!nmtst_dhcp_manager_get_client(dhcp_manager, AF_INET6, N + 1));
+
+    /* removing the IPv4 clients of the odd ifindexes leaves everything else in place. */
+    for (i = 0; i < N; i += 2)
+        nmtst_dhcp_manager_remove_client(dhcp_manager, clients[1][i]);
+
+    for (i = 0; i < N; i++) {
+        g_assert(nmtst_dhcp_manager_get_client(dhcp_manager, AF_INET, i + 1)
+                 == ((i % 2) ? clients[1][i] : NULL));
+        g_assert(nmtst_dhcp_manager_get_client(dhcp_manager, AF_INET6, i + 1) == clients[0][i]);
+    }
+
+    for (i = 0; i < N; i++) {
+        if (i % 2)
+            nmtst_dhcp_manager_remove_client(dhcp_manager, clients[1][i]);
+        nmtst_dhcp_manager_remove_client(dhcp_manager, clients[0][i]);
+        g_assert(!nmtst_dhcp_manager_get_client(dhcp_manager, AF_INET, i + 1));
+        g_assert(!nmtst_dhcp_manager_get_client(dhcp_manager, AF_INET6, i + 1));
+    }
+
+    for (i = 0; i < N; i++) {
+        g_object_unref(clients[0][i]);
+        g_object_unref(clients[1][i]);
+    }
+
+    nmtst_dhcp_manager_unget(dhcp_manager);
+}
+
+/*****************************************************************************/
+
 NMTST_DEFINE();
 
 int
@@ -776,6 +929,8 @@ main(int argc, char **argv)
     g_test_add_func("/dhcp/client-id-from-string", test_client_id_from_string);
     g_test_add_func("/dhcp/vendor-option-metered", test_vendor_option_metered);
     g_test_add_func("/dhcp/parse-search-list", test_parse_search_list);
+    g_test_add_func("/dhcp/start-delay", test_start_delay);
+    g_test_add_func("/dhcp/manager-client-idx", test_manager_client_idx);
 
     return g_test_run();
 }
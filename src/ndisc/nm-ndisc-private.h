@@ -17,6 +17,13 @@ struct _NMNDiscDataInternal {
     GArray *routes;
     GArray *dns_servers;
     GArray *dns_domains;
+
+    /* The routes are tracked in @routes_idx (by network/plen). @routes
+     * is only a sorted view of the index, regenerated when @routes_dirty. */
+    GHashTable *routes_idx;
+    guint64     routes_seq;
+    gint64      routes_expiry_min;
+    bool        routes_dirty : 1;
 };
 
 typedef struct _NMNDiscDataInternal NMNDiscDataInternal;
@@ -294,6 +294,76 @@ _get_exp(char *buf, gsize buf_size, gint64 now_ns, gint64 expiry_time)
 
 /*****************************************************************************/
 
+typedef struct {
+    NMNDiscRoute route;
+
+    /* a sequence number that increases with each newly added route. For
+     * routes of the same preference, newer routes are sorted first. */
+    guint64 seq;
+} RouteEntry;
+
+static guint
+_route_entry_hash(gconstpointer ptr)
+{
+    const RouteEntry *entry = ptr;
+    NMHashState       h;
+
+    nm_hash_init(&h, 1721396411u);
+    nm_hash_update_vals(&h, entry->route.network, entry->route.plen);
+    return nm_hash_complete(&h);
+}
+
+static gboolean
+_route_entry_equal(gconstpointer a, gconstpointer b)
+{
+    const RouteEntry *entry_a = a;
+    const RouteEntry *entry_b = b;
+
+    return entry_a->route.plen == entry_b->route.plen
+           && IN6_ARE_ADDR_EQUAL(&entry_a->route.network, &entry_b->route.network);
+}
+
+static void
+_route_entry_free(gpointer ptr)
+{
+    nm_g_slice_free((RouteEntry *) ptr);
+}
+
+static int
+_route_entry_cmp(gconstpointer pa, gconstpointer pb, gpointer user_data)
+{
+    const RouteEntry *a = *((const RouteEntry *const *) pa);
+    const RouteEntry *b = *((const RouteEntry *const *) pb);
+
+    NM_CMP_DIRECT(_preference_to_priority(b->route.preference),
+                  _preference_to_priority(a->route.preference));
+    NM_CMP_DIRECT(b->seq, a->seq);
+    return 0;
+}
+
+static void
+_routes_update_array(NMNDiscDataInternal *rdata)
+{
+    gs_free const RouteEntry **entries = NULL;
+    guint                      i, n;
+
+    if (!rdata->routes_dirty)
+        return;
+
+    rdata->routes_dirty = FALSE;
+
+    entries = (const RouteEntry **) nm_utils_hash_keys_to_array(rdata->routes_idx,
+                                                                _route_entry_cmp,
+                                                                NULL,
+                                                                &n);
+
+    g_array_set_size(rdata->routes, n);
+    for (i = 0; i < n; i++)
+        g_array_index(rdata->routes, NMNDiscRoute, i) = entries[i]->route;
+}
+
+/*****************************************************************************/
+
 NMPNetns *
 nm_ndisc_netns_get(NMNDisc *self)
 {
@@ -384,6 +454,7 @@ static const NMNDiscData *
 _data_complete(NMNDiscDataInternal *data)
 {
     _ASSERT_data_gateways(data);
+    _routes_update_array(data);
 
 #define _SET(data, field)                                      \
     G_STMT_START                                               \
@@ -406,6 +477,7 @@ _data_complete(NMNDiscDataInternal *data)
 void
 nm_ndisc_emit_config_change(NMNDisc *self, NMNDiscConfigMap changed)
 {
+    _routes_update_array(&NM_NDISC_GET_PRIVATE(self)->rdata);
     _config_changed_log(self, changed);
     g_signal_emit(self,
                   signals[CONFIG_RECEIVED],
@@ -649,8 +721,8 @@ nm_ndisc_add_route(NMNDisc *ndisc, const NMNDiscRoute *new)
 {
     NMNDiscPrivate *     priv;
     NMNDiscDataInternal *rdata;
-    guint                i;
-    guint                insert_idx = G_MAXUINT;
+    RouteEntry *         entry;
+    gint64               expiry;
 
     if (new->plen == 0 || new->plen > 128) {
         /* Only expect non-default routes.  The router has no idea what the
@@ -666,40 +738,47 @@ nm_ndisc_add_route(NMNDisc *ndisc, const NMNDiscRoute *new)
     priv  = NM_NDISC_GET_PRIVATE(ndisc);
     rdata = &priv->rdata;
 
-    for (i = 0; i < rdata->routes->len;) {
-        NMNDiscRoute *item = &g_array_index(rdata->routes, NMNDiscRoute, i);
-
-        if (IN6_ARE_ADDR_EQUAL(&item->network, &new->network) && item->plen == new->plen) {
-            if (new->lifetime == 0) {
-                g_array_remove_index(rdata->routes, i);
-                return TRUE;
-            }
+    entry = g_hash_table_lookup(rdata->routes_idx, &((const RouteEntry){.route = *new}));
 
-            if (item->preference != new->preference) {
-                g_array_remove_index(rdata->routes, i);
-                continue;
-            }
+    if (entry) {
+        if (new->lifetime == 0) {
+            g_hash_table_remove(rdata->routes_idx, entry);
+            rdata->routes_dirty = TRUE;
+            return TRUE;
+        }
 
-            if (get_expiry(item) == get_expiry(new)
-                && IN6_ARE_ADDR_EQUAL(&item->gateway, &new->gateway))
+        if (entry->route.preference == new->preference) {
+            if (get_expiry(&entry->route) == get_expiry(new)
+                && IN6_ARE_ADDR_EQUAL(&entry->route.gateway, &new->gateway))
                 return FALSE;
 
-            *item = *new;
-            return TRUE;
+            entry->route        = *new;
+            rdata->routes_dirty = TRUE;
+            goto out_expiry;
         }
 
-        /* Put before less preferable routes. */
-        if (_preference_to_priority(item->preference) < _preference_to_priority(new->preference)
-            && insert_idx == G_MAXUINT)
-            insert_idx = i;
-
-        i++;
+        /* the preference changed. Re-add the route, which sorts it
+         * first among the routes of the new preference. */
+        g_hash_table_remove(rdata->routes_idx, entry);
+        rdata->routes_dirty = TRUE;
     }
 
-    if (new->lifetime) {
-        g_array_insert_val(rdata->routes, insert_idx == G_MAXUINT ? 0u : insert_idx, *new);
-    }
-    return !!new->lifetime;
+    if (!new->lifetime)
+        return FALSE;
+
+    entry  = g_slice_new(RouteEntry);
+    *entry = (RouteEntry){
+        .route = *new,
+        .seq   = ++rdata->routes_seq,
+    };
+    g_hash_table_add(rdata->routes_idx, entry);
+    rdata->routes_dirty = TRUE;
+
+out_expiry:
+    expiry = get_expiry(new);
+    if (rdata->routes_expiry_min > expiry)
+        rdata->routes_expiry_min = expiry;
+    return TRUE;
 }
 
 gboolean
@@ -1095,6 +1174,9 @@ nm_ndisc_stop(NMNDisc *ndisc)
     g_array_set_size(rdata->gateways, 0);
     g_array_set_size(rdata->addresses, 0);
     g_array_set_size(rdata->routes, 0);
+    g_hash_table_remove_all(rdata->routes_idx);
+    rdata->routes_dirty      = FALSE;
+    rdata->routes_expiry_min = _EXPIRY_INFINITY;
     g_array_set_size(rdata->dns_servers, 0);
     g_array_set_size(rdata->dns_domains, 0);
     priv->rdata.public.hop_limit = 64;
@@ -1301,21 +1383,34 @@ static void
 clean_routes(NMNDisc *ndisc, gint32 now, NMNDiscConfigMap *changed, gint32 *nextevent)
 {
     NMNDiscDataInternal *rdata;
-    guint                i;
+    GHashTableIter       iter;
+    RouteEntry *         entry;
+    gint64               expiry_min;
 
     rdata = &NM_NDISC_GET_PRIVATE(ndisc)->rdata;
 
-    for (i = 0; i < rdata->routes->len;) {
-        NMNDiscRoute *item = &g_array_index(rdata->routes, NMNDiscRoute, i);
+    /* @routes_expiry_min is a lower bound for the expiry of all routes. As long as
+     * it didn't pass, there is nothing to clean up and we don't need to visit
+     * every route (of which there may be many). */
+    if (expiry_next(now, rdata->routes_expiry_min, nextevent))
+        return;
 
-        if (!expiry_next(now, get_expiry(item), nextevent)) {
-            g_array_remove_index(rdata->routes, i);
+    expiry_min = _EXPIRY_INFINITY;
+    g_hash_table_iter_init(&iter, rdata->routes_idx);
+    while (g_hash_table_iter_next(&iter, (gpointer *) &entry, NULL)) {
+        gint64 expiry = get_expiry(&entry->route);
+
+        if (!expiry_next(now, expiry, nextevent)) {
+            g_hash_table_iter_remove(&iter);
+            rdata->routes_dirty = TRUE;
             *changed |= NM_NDISC_CONFIG_ROUTES;
             continue;
         }
 
-        i++;
+        if (expiry_min > expiry)
+            expiry_min = expiry;
     }
+    rdata->routes_expiry_min = expiry_min;
 }
 
 static void
@@ -1529,6 +1624,9 @@ nm_ndisc_init(NMNDisc *ndisc)
     rdata->addresses   = g_array_new(FALSE, FALSE, sizeof(NMNDiscAddress));
     rdata->routes      = g_array_new(FALSE, FALSE, sizeof(NMNDiscRoute));
     rdata->dns_servers = g_array_new(FALSE, FALSE, sizeof(NMNDiscDNSServer));
+    rdata->routes_idx =
+        g_hash_table_new_full(_route_entry_hash, _route_entry_equal, _route_entry_free, NULL);
+    rdata->routes_expiry_min = _EXPIRY_INFINITY;
     rdata->dns_domains = g_array_new(FALSE, FALSE, sizeof(NMNDiscDNSDomain));
     g_array_set_clear_func(rdata->dns_domains, dns_domain_free);
     priv->rdata.public.hop_limit = 64;
@@ -1568,6 +1666,7 @@ finalize(GObject *object)
     g_array_unref(rdata->gateways);
     g_array_unref(rdata->addresses);
     g_array_unref(rdata->routes);
+    g_hash_table_unref(rdata->routes_idx);
     g_array_unref(rdata->dns_servers);
     g_array_unref(rdata->dns_domains);
 
@@ -513,6 +513,102 @@ test_dns_solicit_loop(void)
     g_main_loop_unref(data.loop);
 }
 
+#define MANY_ROUTES_N 1000
+
+static void
+test_many_routes_changed(NMNDisc *ndisc, const NMNDiscData *rdata, guint changed_int, TestData *data)
+{
+    NMNDiscConfigMap changed = changed_int;
+
+    g_assert(changed & NM_NDISC_CONFIG_ROUTES);
+    g_assert_cmpint(rdata->routes_n, ==, MANY_ROUTES_N);
+
+    /* high preference routes sort first, and among routes of the same
+     * preference the most recently added comes first. */
+    match_route(rdata,
+                0,
+                "2001:db8:1:1::",
+                80,
+                "fe80::1",
+                data->timestamp1,
+                10,
+                NM_ICMPV6_ROUTER_PREF_HIGH);
+    match_route(rdata,
+                1,
+                "2001:db8:0:0:3e6::",
+                80,
+                "fe80::1",
+                data->timestamp1,
+                10,
+                NM_ICMPV6_ROUTER_PREF_MEDIUM);
+    match_route(rdata,
+                MANY_ROUTES_N - 1,
+                "2001:db8::",
+                80,
+                "fe80::1",
+                data->timestamp1,
+                10,
+                NM_ICMPV6_ROUTER_PREF_MEDIUM);
+
+    g_assert(nm_fake_ndisc_done(NM_FAKE_NDISC(ndisc)));
+    data->counter++;
+    g_main_loop_quit(data->loop);
+}
+
+static void
+test_many_routes(void)
+{
+    NMFakeNDisc *ndisc = ndisc_new();
+    guint32      now   = nm_utils_get_monotonic_timestamp_sec();
+    TestData     data  = {g_main_loop_new(NULL, FALSE), 0, 0, now};
+    gint64       start_ns;
+    guint        id;
+    guint        i;
+
+    /* A router that announces many Route Information Options. Use a plen
+     * other than 64, so that no addresses get generated. */
+    id = nm_fake_ndisc_add_ra(ndisc, 0, NM_NDISC_DHCP_LEVEL_NONE, 4, 1500);
+    g_assert(id);
+    nm_fake_ndisc_add_gateway(ndisc, id, "fe80::1", now, 10, NM_ICMPV6_ROUTER_PREF_MEDIUM);
+    for (i = 0; i < MANY_ROUTES_N - 1; i++) {
+        char network[INET6_ADDRSTRLEN];
+
+        nm_sprintf_buf(network, "2001:db8:0:0:%x::", i);
+        nm_fake_ndisc_add_prefix(ndisc,
+                                 id,
+                                 network,
+                                 80,
+                                 "fe80::1",
+                                 now,
+                                 10,
+                                 0,
+                                 NM_ICMPV6_ROUTER_PREF_MEDIUM);
+    }
+    nm_fake_ndisc_add_prefix(ndisc,
+                             id,
+                             "2001:db8:1:1::",
+                             80,
+                             "fe80::1",
+                             now,
+                             10,
+                             0,
+                             NM_ICMPV6_ROUTER_PREF_HIGH);
+
+    g_signal_connect(ndisc, NM_NDISC_CONFIG_RECEIVED, G_CALLBACK(test_many_routes_changed), &data);
+
+    start_ns = nm_utils_get_monotonic_timestamp_nsec();
+    nm_ndisc_start(NM_NDISC(ndisc));
+    g_main_loop_run(data.loop);
+    g_assert_cmpint(data.counter, ==, 1);
+
+    g_test_message("processed RA with %u routes in %.3f msec",
+                   (guint) MANY_ROUTES_N,
+                   (double) (nm_utils_get_monotonic_timestamp_nsec() - start_ns) / 1000000.0);
+
+    g_object_unref(ndisc);
+    g_main_loop_unref(data.loop);
+}
+
 NMTST_DEFINE();
 
 int
@@ -533,6 +629,7 @@ main(int argc, char **argv)
     g_test_add_func("/ndisc/preference-order", test_preference_order);
     g_test_add_func("/ndisc/preference-changed", test_preference_changed);
     g_test_add_func("/ndisc/dns-solicit-loop", test_dns_solicit_loop);
+    g_test_add_func("/ndisc/many-routes", test_many_routes);
 
     return g_test_run();
 }
@@ -24,6 +24,7 @@
 typedef struct {
     CList              call_ids_lst_head;
     NMUtilsShareRules *share_rules;
+    gint64             created_msec;
 } NMActRequestPrivate;
 
 struct _NMActRequest {
@@ -67,6 +68,22 @@ nm_act_request_get_applied_connection(NMActRequest *req)
     return nm_active_connection_get_applied_connection(NM_ACTIVE_CONNECTION(req));
 }
 
+/**
+ * nm_act_request_get_created_msec:
+ * @req: the #NMActRequest
+ *
+ * Returns: the monotonic timestamp in milliseconds when the activation
+ *   request was created. That is the start of the device's activation
+ *   timeline.
+ */
+gint64
+nm_act_request_get_created_msec(NMActRequest *req)
+{
+    g_return_val_if_fail(NM_IS_ACT_REQUEST(req), 0);
+
+    return NM_ACT_REQUEST_GET_PRIVATE(req)->created_msec;
+}
+
 /*****************************************************************************/
 
 struct _NMActRequestGetSecretsCallId {
@@ -440,6 +457,7 @@ nm_act_request_init(NMActRequest *req)
     NMActRequestPrivate *priv = NM_ACT_REQUEST_GET_PRIVATE(req);
 
     c_list_init(&priv->call_ids_lst_head);
+    priv->created_msec = nm_utils_get_monotonic_timestamp_msec();
 }
 
 /**
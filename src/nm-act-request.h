@@ -36,6 +36,8 @@ NMSettingsConnection *nm_act_request_get_settings_connection(NMActRequest *req);
 
 NMConnection *nm_act_request_get_applied_connection(NMActRequest *req);
 
+gint64 nm_act_request_get_created_msec(NMActRequest *req);
+
 /*****************************************************************************/
 
 struct _NMUtilsShareRules;
@@ -21,6 +21,12 @@
 #define CANCELLATION_ID_PREFIX  "cancellation-id-"
 #define CANCELLATION_TIMEOUT_MS 5000
 
+/* How long a non-interactive result from polkit is reused. PolicyKit
+ * emits "Changed" when its configuration changes, but not when a temporary
+ * authorization (auth_admin_keep) expires. This bounds how long we may
+ * wrongly answer from such an expired authorization. */
+#define AUTH_CACHE_TTL_MSEC 10000
+
 /*****************************************************************************/
 
 NM_GOBJECT_PROPERTIES_DEFINE_BASE(PROP_POLKIT_ENABLED, );
@@ -37,9 +43,11 @@ typedef struct {
     GDBusConnection *dbus_connection;
     GCancellable *   main_cancellable;
     char *           name_owner;
+    GHashTable *     auth_cache;
     guint64          call_numid_counter;
     guint            changed_id;
     guint            name_owner_changed_id;
+    guint            auth_cache_gc_id;
     bool             disposing : 1;
     bool             shutting_down : 1;
     bool             got_name_owner : 1;
@@ -125,21 +133,42 @@ nm_auth_manager_get_polkit_enabled(NMAuthManager *self)
 
 /*****************************************************************************/
 
-static void
-_emit_changed_signal(NMAuthManager *self)
-{
-    g_signal_emit(self, signals[CHANGED_SIGNAL], 0);
-}
-
 typedef enum {
     POLKIT_CHECK_AUTHORIZATION_FLAGS_NONE                   = 0,
     POLKIT_CHECK_AUTHORIZATION_FLAGS_ALLOW_USER_INTERACTION = (1 << 0),
 } PolkitCheckAuthorizationFlags;
 
+/* A CheckAuthorization request to polkit. Callers asking the same
+ * non-interactive question while the request is pending share it,
+ * and afterwards the result stays in the cache for AUTH_CACHE_TTL_MSEC.
+ *
+ * Interactive requests are never shared nor cached: a successful
+ * authentication for an "auth_admin" action is only good for
+ * one call. */
+typedef struct {
+    NMAuthManager *self;
+    char *         action_id;
+    char *         dbus_sender;
+    gulong         pid;
+    gulong         uid;
+
+    /* the NMAuthManagerCallId instances waiting for the result. */
+    CList call_ids_lst_head;
+
+    /* while the D-Bus call is pending, it keeps a reference on @self. */
+    GCancellable *dbus_cancellable;
+
+    gint64  expiry_msec;
+    guint64 call_numid;
+    bool    is_authorized : 1;
+    bool    is_cached : 1;
+} AuthEntry;
+
 struct _NMAuthManagerCallId {
     CList                                   calls_lst;
+    CList                                   entry_lst;
     NMAuthManager *                         self;
-    GCancellable *                          dbus_cancellable;
+    AuthEntry *                             entry;
     NMAuthManagerCheckAuthorizationCallback callback;
     gpointer                                user_data;
     guint64                                 call_numid;
@@ -152,17 +181,151 @@ struct _NMAuthManagerCallId {
                     CANCELLATION_ID_PREFIX "%" G_GUINT64_FORMAT, \
                     (call_numid))
 
+/*****************************************************************************/
+
+static guint
+_auth_entry_hash(gconstpointer ptr)
+{
+    const AuthEntry *entry = ptr;
+    NMHashState      h;
+
+    nm_hash_init(&h, 1721186053u);
+    nm_hash_update_vals(&h, entry->pid, entry->uid);
+    nm_hash_update_str0(&h, entry->dbus_sender);
+    nm_hash_update_str(&h, entry->action_id);
+    return nm_hash_complete(&h);
+}
+
+static gboolean
+_auth_entry_equal(gconstpointer ptr_a, gconstpointer ptr_b)
+{
+    const AuthEntry *a = ptr_a;
+    const AuthEntry *b = ptr_b;
+
+    return a->pid == b->pid && a->uid == b->uid && nm_streq0(a->dbus_sender, b->dbus_sender)
+           && nm_streq(a->action_id, b->action_id);
+}
+
+static void
+_auth_entry_free(AuthEntry *entry)
+{
+    nm_assert(!entry->is_cached);
+    nm_assert(!entry->dbus_cancellable);
+    nm_assert(c_list_is_empty(&entry->call_ids_lst_head));
+
+    g_free(entry->action_id);
+    g_free(entry->dbus_sender);
+    nm_g_slice_free(entry);
+}
+
+static void
+_auth_entry_uncache(AuthEntry *entry)
+{
+    NMAuthManagerPrivate *priv = NM_AUTH_MANAGER_GET_PRIVATE(entry->self);
+
+    if (!entry->is_cached)
+        return;
+
+    entry->is_cached = FALSE;
+    if (!g_hash_table_remove(priv->auth_cache, entry))
+        nm_assert_not_reached();
+}
+
+static void
+_auth_cache_clear(NMAuthManager *self, gboolean only_expired)
+{
+    NMAuthManagerPrivate *priv = NM_AUTH_MANAGER_GET_PRIVATE(self);
+    GHashTableIter        iter;
+    AuthEntry *           entry;
+    gint64                now_msec = 0;
+
+    if (!priv->auth_cache)
+        return;
+
+    g_hash_table_iter_init(&iter, priv->auth_cache);
+    while (g_hash_table_iter_next(&iter, (gpointer *) &entry, NULL)) {
+        if (only_expired) {
+            if (entry->dbus_cancellable
+                || entry->expiry_msec > nm_utils_get_monotonic_timestamp_msec_cached(&now_msec))
+                continue;
+        }
+
+        g_hash_table_iter_remove(&iter);
+        entry->is_cached = FALSE;
+
+        /* a pending request still completes for its callers, but its
+         * result is no longer cached. */
+        if (!entry->dbus_cancellable)
+            _auth_entry_free(entry);
+    }
+}
+
+static gboolean
+_auth_cache_gc_cb(gpointer user_data)
+{
+    NMAuthManager *       self = user_data;
+    NMAuthManagerPrivate *priv = NM_AUTH_MANAGER_GET_PRIVATE(self);
+
+    priv->auth_cache_gc_id = 0;
+
+    _auth_cache_clear(self, TRUE);
+
+    if (g_hash_table_size(priv->auth_cache) > 0)
+        priv->auth_cache_gc_id = g_timeout_add(AUTH_CACHE_TTL_MSEC, _auth_cache_gc_cb, self);
+    return G_SOURCE_REMOVE;
+}
+
+static AuthEntry *
+_auth_cache_lookup(NMAuthManager *self, NMAuthSubject *subject, const char *action_id)
+{
+    NMAuthManagerPrivate *priv   = NM_AUTH_MANAGER_GET_PRIVATE(self);
+    const AuthEntry       needle = {
+        .action_id   = (char *) action_id,
+        .dbus_sender = (char *) nm_auth_subject_get_unix_process_dbus_sender(subject),
+        .pid         = nm_auth_subject_get_unix_process_pid(subject),
+        .uid         = nm_auth_subject_get_unix_process_uid(subject),
+    };
+    AuthEntry *entry;
+
+    entry = g_hash_table_lookup(priv->auth_cache, &needle);
+    if (entry && !entry->dbus_cancellable
+        && entry->expiry_msec <= nm_utils_get_monotonic_timestamp_msec()) {
+        _auth_entry_uncache(entry);
+        _auth_entry_free(entry);
+        return NULL;
+    }
+    return entry;
+}
+
+/*****************************************************************************/
+
+static void
+_emit_changed_signal(NMAuthManager *self)
+{
+    /* whatever polkit told us before may no longer be valid. */
+    _auth_cache_clear(self, FALSE);
+
+    g_signal_emit(self, signals[CHANGED_SIGNAL], 0);
+}
+
+/*****************************************************************************/
+
 static void
 _call_id_free(NMAuthManagerCallId *call_id)
 {
+    AuthEntry *entry = g_steal_pointer(&call_id->entry);
+
     c_list_unlink(&call_id->calls_lst);
     nm_clear_g_source(&call_id->idle_id);
 
-    if (call_id->dbus_cancellable) {
-        /* we have a pending D-Bus call. We keep the call-id instance alive
-         * for _call_check_authorize_cb() */
-        g_cancellable_cancel(call_id->dbus_cancellable);
-        return;
+    if (entry) {
+        c_list_unlink(&call_id->entry_lst);
+        if (c_list_is_empty(&entry->call_ids_lst_head) && entry->dbus_cancellable) {
+            /* nobody is waiting for the pending D-Bus call anymore. Cancel it.
+             * The entry stays alive until _entry_check_authorize_cb(). */
+            _auth_entry_uncache(entry);
+            g_cancellable_cancel(entry->dbus_cancellable);
+        }
     }
 
     g_object_unref(call_id->self);
@@ -185,27 +348,32 @@ _call_id_invoke_callback(NMAuthManagerCallId *call_id,
 static void
 cancel_check_authorization_cb(GObject *source, GAsyncResult *res, gpointer user_data)
 {
-    NMAuthManagerCallId *call_id     = user_data;
+    AuthEntry *entry                 = user_data;
+    NMAuthManager *self              = entry->self;
     gs_unref_variant GVariant *value = NULL;
     gs_free_error GError *error      = NULL;
 
     value = g_dbus_connection_call_finish(G_DBUS_CONNECTION(source), res, &error);
     if (g_error_matches(error, G_IO_ERROR, G_IO_ERROR_CANCELLED))
-        _LOG2T(call_id, "cancel request was cancelled");
+        _LOGT("call[%" G_GUINT64_FORMAT "]: cancel request was cancelled", entry->call_numid);
     else if (error)
-        _LOG2T(call_id, "cancel request failed: %s", error->message);
+        _LOGT("call[%" G_GUINT64_FORMAT "]: cancel request failed: %s",
+              entry->call_numid,
+              error->message);
     else
-        _LOG2T(call_id, "cancel request succeeded");
+        _LOGT("call[%" G_GUINT64_FORMAT "]: cancel request succeeded", entry->call_numid);
 
-    _call_id_free(call_id);
+    _auth_entry_free(entry);
+    g_object_unref(self);
 }
 
 static void
-_call_check_authorize_cb(GObject *proxy, GAsyncResult *res, gpointer user_data)
+_entry_check_authorize_cb(GObject *proxy, GAsyncResult *res, gpointer user_data)
 {
-    NMAuthManagerCallId * call_id = user_data;
-    NMAuthManager *       self;
-    NMAuthManagerPrivate *priv;
+    AuthEntry *           entry = user_data;
+    NMAuthManager *       self  = entry->self;
+    NMAuthManagerPrivate *priv  = NM_AUTH_MANAGER_GET_PRIVATE(self);
+    NMAuthManagerCallId * call_id;
     gs_unref_variant GVariant *value    = NULL;
     gs_free_error GError *error         = NULL;
     gboolean              is_authorized = FALSE;
@@ -214,22 +382,21 @@ _call_check_authorize_cb(GObject *proxy, GAsyncResult *res, gpointer user_data)
     /* we need to clear the cancelable, to signal for _call_id_free() that we
      * are not in a pending call.
      *
-     * Note how _call_id_free() kept call-id alive, even if the request was
-     * already cancelled. */
-    g_clear_object(&call_id->dbus_cancellable);
-
-    self = call_id->self;
-    priv = NM_AUTH_MANAGER_GET_PRIVATE(self);
+     * Note that the pending call still holds a reference on @self. */
+    g_clear_object(&entry->dbus_cancellable);
 
     value = g_dbus_connection_call_finish(G_DBUS_CONNECTION(proxy), res, &error);
 
     if (nm_utils_error_is_cancelled(error)) {
-        /* call_id was cancelled externally, but _call_id_free() kept call_id
-         * alive (and it has still the reference on @self. */
+        /* all callers went away. _call_id_free() already removed the
+         * entry from the cache. */
+        nm_assert(!entry->is_cached);
+        nm_assert(c_list_is_empty(&entry->call_ids_lst_head));
 
         if (!priv->main_cancellable) {
             /* we do a forced shutdown. There is no more time for cancelling... */
-            _call_id_free(call_id);
+            _auth_entry_free(entry);
+            g_object_unref(self);
 
             /* this shouldn't really happen, because:
              * nm_auth_manager_check_authorization() only scheduled the D-Bus request at a time when
@@ -247,23 +414,50 @@ _call_check_authorize_cb(GObject *proxy, GAsyncResult *res, gpointer user_data)
                                POLKIT_OBJECT_PATH,
                                POLKIT_INTERFACE,
                                "CancelCheckAuthorization",
-                               g_variant_new("(s)", cancellation_id_to_str_a(call_id->call_numid)),
+                               g_variant_new("(s)", cancellation_id_to_str_a(entry->call_numid)),
                                G_VARIANT_TYPE("()"),
                                G_DBUS_CALL_FLAGS_NONE,
                                CANCELLATION_TIMEOUT_MS,
                                priv->main_cancellable,
                                cancel_check_authorization_cb,
-                               call_id);
+                               entry);
         return;
     }
 
     if (!error) {
         g_variant_get(value, "((bb@a{ss}))", &is_authorized, &is_challenge, NULL);
-        _LOG2T(call_id, "completed: authorized=%d, challenge=%d", is_authorized, is_challenge);
+        _LOGT("call[%" G_GUINT64_FORMAT "]: completed: authorized=%d, challenge=%d",
+              entry->call_numid,
+              is_authorized,
+              is_challenge);
     } else
-        _LOG2T(call_id, "completed: failed: %s", error->message);
+        _LOGT("call[%" G_GUINT64_FORMAT "]: completed: failed: %s",
+              entry->call_numid,
+              error->message);
+
+    if (entry->is_cached) {
+        /* a challenge means the answer depends on the user authenticating,
+         * so only remember definite answers. */
+        if (!error && !is_challenge) {
+            entry->is_authorized = is_authorized;
+            entry->expiry_msec   = nm_utils_get_monotonic_timestamp_msec() + AUTH_CACHE_TTL_MSEC;
+            if (!priv->auth_cache_gc_id)
+                priv->auth_cache_gc_id =
+                    g_timeout_add(AUTH_CACHE_TTL_MSEC, _auth_cache_gc_cb, self);
+        } else
+            _auth_entry_uncache(entry);
+    }
+
+    while ((call_id = c_list_first_entry(&entry->call_ids_lst_head, NMAuthManagerCallId, entry_lst))) {
+        c_list_unlink(&call_id->entry_lst);
+        call_id->entry = NULL;
+        _call_id_invoke_callback(call_id, is_authorized, is_challenge, error);
+    }
 
-    _call_id_invoke_callback(call_id, is_authorized, is_challenge, error);
+    if (!entry->is_cached)
+        _auth_entry_free(entry);
+
+    g_object_unref(self);
 }
 
 static gboolean
@@ -310,6 +504,7 @@ nm_auth_manager_check_authorization(NMAuthManager *                         self
     PolkitCheckAuthorizationFlags flags;
     char                          subject_buf[64];
     NMAuthManagerCallId *         call_id;
+    AuthEntry *                   entry;
 
     g_return_val_if_fail(NM_IS_AUTH_MANAGER(self), NULL);
     g_return_val_if_fail(NM_IN_SET(nm_auth_subject_get_subject_type(subject),
@@ -357,6 +552,26 @@ nm_auth_manager_check_authorization(NMAuthManager *                         self
                priv->auth_polkit_mode == NM_AUTH_POLKIT_MODE_ALLOW_ALL ? "grant" : "deny");
         call_id->idle_is_authorized = (priv->auth_polkit_mode == NM_AUTH_POLKIT_MODE_ALLOW_ALL);
         call_id->idle_id            = g_idle_add(_call_on_idle, call_id);
+    } else if (!allow_user_interaction
+               && (entry = _auth_cache_lookup(self, subject, action_id))) {
+        if (!entry->dbus_cancellable) {
+            _LOG2T(call_id,
+                   "CheckAuthorization(%s), subject=%s (cached result %s authorization)",
+                   action_id,
+                   nm_auth_subject_to_string(subject, subject_buf, sizeof(subject_buf)),
+                   entry->is_authorized ? "grants" : "denies");
+            call_id->idle_is_authorized = entry->is_authorized;
+            call_id->idle_id            = g_idle_add(_call_on_idle, call_id);
+        } else {
+            _LOG2T(call_id,
+                   "CheckAuthorization(%s), subject=%s (waiting for pending call[%" G_GUINT64_FORMAT
+                   "])",
+                   action_id,
+                   nm_auth_subject_to_string(subject, subject_buf, sizeof(subject_buf)),
+                   entry->call_numid);
+            call_id->entry = entry;
+            c_list_link_tail(&entry->call_ids_lst_head, &call_id->entry_lst);
+        }
     } else {
         GVariant *      parameters;
         GVariantBuilder builder;
@@ -382,10 +597,30 @@ nm_auth_manager_check_authorization(NMAuthManager *                         self
                action_id,
                nm_auth_subject_to_string(subject, subject_buf, sizeof(subject_buf)));
 
-        call_id->dbus_cancellable = g_cancellable_new();
+        entry  = g_slice_new(AuthEntry);
+        *entry = (AuthEntry){
+            .self              = self,
+            .action_id         = g_strdup(action_id),
+            .dbus_sender       = g_strdup(nm_auth_subject_get_unix_process_dbus_sender(subject)),
+            .pid               = nm_auth_subject_get_unix_process_pid(subject),
+            .uid               = nm_auth_subject_get_unix_process_uid(subject),
+            .dbus_cancellable  = g_cancellable_new(),
+            .call_numid        = call_id->call_numid,
+        };
+        c_list_init(&entry->call_ids_lst_head);
+        call_id->entry = entry;
+        c_list_link_tail(&entry->call_ids_lst_head, &call_id->entry_lst);
+
+        if (!allow_user_interaction) {
+            entry->is_cached = TRUE;
+            g_hash_table_add(priv->auth_cache, entry);
+        }
 
         nm_assert(priv->main_cancellable);
 
+        /* the pending call keeps @self alive, also after all callers
+         * cancelled, for the CancelCheckAuthorization request. */
+        g_object_ref(self);
         g_dbus_connection_call(priv->dbus_connection,
                                POLKIT_SERVICE,
                                POLKIT_OBJECT_PATH,
@@ -395,9 +630,9 @@ nm_auth_manager_check_authorization(NMAuthManager *                         self
                                G_VARIANT_TYPE("((bba{ss}))"),
                                G_DBUS_CALL_FLAGS_NONE,
                                G_MAXINT, /* no timeout */
-                               call_id->dbus_cancellable,
-                               _call_check_authorize_cb,
-                               call_id);
+                               entry->dbus_cancellable,
+                               _entry_check_authorize_cb,
+                               entry);
     }
 
     return call_id;
@@ -602,6 +837,7 @@ nm_auth_manager_init(NMAuthManager *self)
 
     c_list_init(&priv->calls_lst_head);
     priv->auth_polkit_mode = NM_AUTH_POLKIT_MODE_ROOT_ONLY;
+    priv->auth_cache       = g_hash_table_new(_auth_entry_hash, _auth_entry_equal);
 }
 
 static void
@@ -712,6 +948,13 @@ dispose(GObject *object)
 
     nm_clear_g_dbus_connection_signal(priv->dbus_connection, &priv->changed_id);
 
+    nm_clear_g_source(&priv->auth_cache_gc_id);
+    if (priv->auth_cache) {
+        /* pending requests keep us alive, so only cached results are left. */
+        _auth_cache_clear(self, FALSE);
+        nm_clear_pointer(&priv->auth_cache, g_hash_table_unref);
+    }
+
     G_OBJECT_CLASS(nm_auth_manager_parent_class)->dispose(object);
 
     g_clear_object(&priv->dbus_connection);
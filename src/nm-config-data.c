@@ -8,6 +8,7 @@
 
 #include "nm-config-data.h"
 
+#include "nm-glib-aux/nm-c-list.h"
 #include "nm-config.h"
 #include "devices/nm-device.h"
 #include "nm-core-internal.h"
@@ -23,11 +24,34 @@ typedef struct {
         /* have a separate boolean field @has, because a @spec with
          * value %NULL does not necessarily mean, that the property
          * "match-device" was unspecified. */
-        gboolean has;
-        GSList * spec;
+        gboolean           has;
+        GSList *           spec;
+        NMMatchSpecDevice *compiled;
     } match_device;
+
+    /* the index into MatchMemo.results. */
+    guint memo_idx;
 } MatchSectionInfo;
 
+typedef enum {
+    MATCH_MEMO_UNKNOWN = 0,
+    MATCH_MEMO_NO,
+    MATCH_MEMO_YES,
+} MatchMemoResult;
+
+/* The match results of all [device*] and [connection*] sections for
+ * one set of device properties. As the properties are the key, a
+ * result never gets stale when a device changes (e.g. it gets renamed);
+ * the lookup just yields a different entry. On reload, there is a new
+ * NMConfigData instance, with a fresh memo. */
+typedef struct {
+    CList                 memo_lst;
+    NMMatchSpecDeviceData data;
+    guint8                results[];
+} MatchMemo;
+
+#define MATCH_MEMO_MAX 4096
+
 struct _NMGlobalDnsDomain {
     char * name;
     char **servers;
@@ -70,6 +94,12 @@ typedef struct {
      * [device] sections. This is to speed up lookup. */
     MatchSectionInfo *device_infos;
 
+    /* MatchMemo instances, see _match_memo_get(). The list is in order
+     * of last use, the least recently used memo comes first. */
+    GHashTable *match_memo;
+    CList       match_memo_lst_head;
+    guint       match_memo_n_results;
+
     struct {
         gboolean enabled;
         char *   uri;
@@ -1374,22 +1404,143 @@ global_dns_equal(NMGlobalDnsConfig *old, NMGlobalDnsConfig *new)
 
 /*****************************************************************************/
 
+static guint
+_match_memo_hash(gconstpointer ptr)
+{
+    const MatchMemo *memo = ptr;
+    NMHashState      h;
+
+    nm_hash_init(&h, 2029541387u);
+    nm_hash_update_str0(&h, memo->data.interface_name);
+    nm_hash_update_str0(&h, memo->data.device_type);
+    nm_hash_update_str0(&h, memo->data.driver);
+    nm_hash_update_str0(&h, memo->data.driver_version);
+    nm_hash_update_str0(&h, memo->data.hwaddr);
+    nm_hash_update_str0(&h, memo->data.s390_subchannels);
+    nm_hash_update_str0(&h, memo->data.dhcp_plugin);
+    return nm_hash_complete(&h);
+}
+
+static gboolean
+_match_memo_equal(gconstpointer ptr_a, gconstpointer ptr_b)
+{
+    const MatchMemo *a = ptr_a;
+    const MatchMemo *b = ptr_b;
+
+    return nm_streq0(a->data.interface_name, b->data.interface_name)
+           && nm_streq0(a->data.device_type, b->data.device_type)
+           && nm_streq0(a->data.driver, b->data.driver)
+           && nm_streq0(a->data.driver_version, b->data.driver_version)
+           && nm_streq0(a->data.hwaddr, b->data.hwaddr)
+           && nm_streq0(a->data.s390_subchannels, b->data.s390_subchannels)
+           && nm_streq0(a->data.dhcp_plugin, b->data.dhcp_plugin);
+}
+
+static const char *
+_match_memo_strdup(char **p_buf, const char *str)
+{
+    const char *s;
+    gsize       l;
+
+    if (!str)
+        return NULL;
+
+    l = strlen(str) + 1;
+    s = memcpy(*p_buf, str, l);
+    *p_buf += l;
+    return s;
+}
+
+static void
+_match_memo_free(gpointer ptr)
+{
+    MatchMemo *memo = ptr;
+
+    c_list_unlink_stale(&memo->memo_lst);
+    g_free(memo);
+}
+
+static MatchMemo *
+_match_memo_get(NMConfigDataPrivate *priv, const NMMatchSpecDeviceData *data)
+{
+    const MatchMemo needle = {
+        .data = *data,
+    };
+    MatchMemo *memo;
+    gsize      l_str;
+    char *     buf;
+
+    memo = g_hash_table_lookup(priv->match_memo, &needle);
+    if (memo) {
+        nm_c_list_move_tail(&priv->match_memo_lst_head, &memo->memo_lst);
+        return memo;
+    }
+
+    /* the key is the device properties. A device that changes them leaves a
+     * stale entry behind, so don't let the memo grow without bound. The limit
+     * is well above the number of devices we expect; when it is reached, evict
+     * the least recently used memo. */
+    if (g_hash_table_size(priv->match_memo) >= MATCH_MEMO_MAX) {
+        g_hash_table_remove(
+            priv->match_memo,
+            c_list_first_entry(&priv->match_memo_lst_head, MatchMemo, memo_lst));
+    }
+
+    l_str = (data->interface_name ? strlen(data->interface_name) + 1 : 0)
+            + (data->device_type ? strlen(data->device_type) + 1 : 0)
+            + (data->driver ? strlen(data->driver) + 1 : 0)
+            + (data->driver_version ? strlen(data->driver_version) + 1 : 0)
+            + (data->hwaddr ? strlen(data->hwaddr) + 1 : 0)
+            + (data->s390_subchannels ? strlen(data->s390_subchannels) + 1 : 0)
+            + (data->dhcp_plugin ? strlen(data->dhcp_plugin) + 1 : 0);
+
+    memo = g_malloc0(sizeof(MatchMemo) + priv->match_memo_n_results + l_str);
+    buf  = (char *) &memo->results[priv->match_memo_n_results];
+    memo->data = (NMMatchSpecDeviceData){
+        .interface_name   = _match_memo_strdup(&buf, data->interface_name),
+        .device_type      = _match_memo_strdup(&buf, data->device_type),
+        .driver           = _match_memo_strdup(&buf, data->driver),
+        .driver_version   = _match_memo_strdup(&buf, data->driver_version),
+        .hwaddr           = _match_memo_strdup(&buf, data->hwaddr),
+        .s390_subchannels = _match_memo_strdup(&buf, data->s390_subchannels),
+        .dhcp_plugin      = _match_memo_strdup(&buf, data->dhcp_plugin),
+    };
+    nm_assert(buf == &((char *) &memo->results[priv->match_memo_n_results])[l_str]);
+
+    c_list_link_tail(&priv->match_memo_lst_head, &memo->memo_lst);
+    g_hash_table_add(priv->match_memo, memo);
+    return memo;
+}
+
+static gboolean
+_match_memo_eval(MatchMemo *memo, const MatchSectionInfo *match_section_info)
+{
+    guint8 *result = &memo->results[match_section_info->memo_idx];
+
+    if (*result == MATCH_MEMO_UNKNOWN) {
+        *result = nm_match_spec_device_match(match_section_info->match_device.compiled,
+                                             &memo->data)
+                          == NM_MATCH_SPEC_MATCH
+                      ? MATCH_MEMO_YES
+                      : MATCH_MEMO_NO;
+    }
+    return *result == MATCH_MEMO_YES;
+}
+
 static const MatchSectionInfo *
-_match_section_infos_lookup(const MatchSectionInfo *match_section_infos,
-                            GKeyFile *              keyfile,
+_match_section_infos_lookup(NMConfigDataPrivate *   priv,
+                            const MatchSectionInfo *match_section_infos,
                             const char *            property,
                             NMDevice *              device,
                             const NMPlatformLink *  pllink,
                             const char *            match_device_type,
                             char **                 out_value)
 {
-    const char *match_dhcp_plugin;
+    MatchMemo *memo = NULL;
 
     if (!match_section_infos)
         return NULL;
 
-    match_dhcp_plugin = nm_dhcp_manager_get_config(nm_dhcp_manager_get());
-
     for (; match_section_infos->group_name; match_section_infos++) {
         char *   value = NULL;
         gboolean match;
@@ -1401,21 +1552,34 @@ _match_section_infos_lookup(const MatchSectionInfo *match_section_infos,
          * string_to_value(keyfile_to_string(keyfile)) in one. Optimally, keyfile library would
          * expose both functions, and we would return here keyfile_to_string(keyfile).
          * The caller then could convert the string to the proper value via string_to_value(value). */
-        value = g_key_file_get_string(keyfile, match_section_infos->group_name, property, NULL);
+        value =
+            g_key_file_get_string(priv->keyfile, match_section_infos->group_name, property, NULL);
         if (!value && !match_section_infos->stop_match)
             continue;
 
         if (match_section_infos->match_device.has) {
-            if (device)
-                match = nm_device_spec_match_list(device, match_section_infos->match_device.spec);
-            else if (pllink)
-                match = nm_match_spec_device_by_pllink(pllink,
-                                                       match_device_type,
-                                                       match_dhcp_plugin,
-                                                       match_section_infos->match_device.spec,
-                                                       FALSE);
-            else
+            if (!device && !pllink)
                 match = FALSE;
+            else {
+                if (!memo) {
+                    NMMatchSpecDeviceData data;
+
+                    if (device)
+                        nm_device_get_match_spec_data(device, &data);
+                    else {
+                        /* we can only match by certain properties that are available on the
+                         * platform link. See nm_match_spec_device_by_pllink(). */
+                        data = (NMMatchSpecDeviceData){
+                            .interface_name = pllink->name,
+                            .device_type    = match_device_type,
+                            .driver         = pllink->driver,
+                            .dhcp_plugin    = nm_dhcp_manager_get_config(nm_dhcp_manager_get()),
+                        };
+                    }
+                    memo = _match_memo_get(priv, &data);
+                }
+                match = _match_memo_eval(memo, match_section_infos);
+            }
         } else
             match = TRUE;
 
@@ -1434,9 +1598,9 @@ nm_config_data_get_device_config(const NMConfigData *self,
                                  NMDevice *          device,
                                  gboolean *          has_match)
 {
-    const NMConfigDataPrivate *priv;
-    const MatchSectionInfo *   connection_info;
-    char *                     value = NULL;
+    NMConfigDataPrivate *   priv;
+    const MatchSectionInfo *connection_info;
+    char *                  value = NULL;
 
     NM_SET_OUT(has_match, FALSE);
 
@@ -1445,8 +1609,8 @@ nm_config_data_get_device_config(const NMConfigData *self,
 
     priv = NM_CONFIG_DATA_GET_PRIVATE(self);
 
-    connection_info = _match_section_infos_lookup(&priv->device_infos[0],
-                                                  priv->keyfile,
+    connection_info = _match_section_infos_lookup(priv,
+                                                  &priv->device_infos[0],
                                                   property,
                                                   device,
                                                   NULL,
@@ -1463,17 +1627,17 @@ nm_config_data_get_device_config_by_pllink(const NMConfigData *  self,
                                            const char *          match_device_type,
                                            gboolean *            has_match)
 {
-    const NMConfigDataPrivate *priv;
-    const MatchSectionInfo *   connection_info;
-    char *                     value = NULL;
+    NMConfigDataPrivate *   priv;
+    const MatchSectionInfo *connection_info;
+    char *                  value = NULL;
 
     g_return_val_if_fail(self, NULL);
     g_return_val_if_fail(property && *property, NULL);
 
     priv = NM_CONFIG_DATA_GET_PRIVATE(self);
 
-    connection_info = _match_section_infos_lookup(&priv->device_infos[0],
-                                                  priv->keyfile,
+    connection_info = _match_section_infos_lookup(priv,
+                                                  &priv->device_infos[0],
                                                   property,
                                                   NULL,
                                                   pllink,
@@ -1504,8 +1668,8 @@ nm_config_data_get_connection_default(const NMConfigData *self,
                                       const char *        property,
                                       NMDevice *          device)
 {
-    const NMConfigDataPrivate *priv;
-    char *                     value = NULL;
+    NMConfigDataPrivate *priv;
+    char *               value = NULL;
 
     g_return_val_if_fail(self, NULL);
     g_return_val_if_fail(property && *property, NULL);
@@ -1526,8 +1690,8 @@ nm_config_data_get_connection_default(const NMConfigData *self,
     }
 #endif
 
-    _match_section_infos_lookup(&priv->connection_infos[0],
-                                priv->keyfile,
+    _match_section_infos_lookup(priv,
+                                &priv->connection_infos[0],
                                 property,
                                 device,
                                 NULL,
@@ -1561,6 +1725,8 @@ _get_connection_info_init(MatchSectionInfo *connection_info, GKeyFile *keyfile,
                                  group,
                                  NM_CONFIG_KEYFILE_KEY_MATCH_DEVICE,
                                  &connection_info->match_device.has);
+    connection_info->match_device.compiled =
+        nm_match_spec_device_new(connection_info->match_device.spec);
     connection_info->stop_match =
         nm_config_keyfile_get_boolean(keyfile, group, NM_CONFIG_KEYFILE_KEY_STOP_MATCH, FALSE);
 }
@@ -1575,12 +1741,13 @@ _match_section_infos_free(MatchSectionInfo *match_section_infos)
     for (i = 0; match_section_infos[i].group_name; i++) {
         g_free(match_section_infos[i].group_name);
         g_slist_free_full(match_section_infos[i].match_device.spec, g_free);
+        nm_match_spec_device_free(match_section_infos[i].match_device.compiled);
     }
     g_free(match_section_infos);
 }
 
 static MatchSectionInfo *
-_match_section_infos_construct(GKeyFile *keyfile, const char *prefix)
+_match_section_infos_construct(GKeyFile *keyfile, const char *prefix, guint *p_memo_idx)
 {
     char **           groups;
     gsize             i, j, ngroups;
@@ -1627,6 +1794,9 @@ _match_section_infos_construct(GKeyFile *keyfile, const char *prefix)
     }
     g_free(groups);
 
+    for (i = 0; match_section_infos[i].group_name; i++)
+        match_section_infos[i].memo_idx = (*p_memo_idx)++;
+
     return match_section_infos;
 }
 
@@ -1839,9 +2009,16 @@ constructed(GObject *object)
     priv->keyfile = _merge_keyfiles(priv->keyfile_user, priv->keyfile_intern);
 
     priv->connection_infos =
-        _match_section_infos_construct(priv->keyfile, NM_CONFIG_KEYFILE_GROUPPREFIX_CONNECTION);
+        _match_section_infos_construct(priv->keyfile,
+                                       NM_CONFIG_KEYFILE_GROUPPREFIX_CONNECTION,
+                                       &priv->match_memo_n_results);
     priv->device_infos =
-        _match_section_infos_construct(priv->keyfile, NM_CONFIG_KEYFILE_GROUPPREFIX_DEVICE);
+        _match_section_infos_construct(priv->keyfile,
+                                       NM_CONFIG_KEYFILE_GROUPPREFIX_DEVICE,
+                                       &priv->match_memo_n_results);
+    c_list_init(&priv->match_memo_lst_head);
+    priv->match_memo =
+        g_hash_table_new_full(_match_memo_hash, _match_memo_equal, _match_memo_free, NULL);
 
     priv->connectivity.enabled =
         nm_config_keyfile_get_boolean(priv->keyfile,
@@ -1998,6 +2175,8 @@ finalize(GObject *gobject)
 
     _match_section_infos_free(priv->connection_infos);
     _match_section_infos_free(priv->device_infos);
+    nm_clear_pointer(&priv->match_memo, g_hash_table_unref);
+    nm_assert(c_list_is_empty(&priv->match_memo_lst_head));
 
     g_key_file_unref(priv->keyfile);
     if (priv->keyfile_user)
@@ -1346,10 +1346,8 @@ match_device_s390_subchannels_parse(const char *s390_subchannels,
 }
 
 static gboolean
-match_data_s390_subchannels_eval(const char *spec_str, MatchDeviceData *match_data)
+match_data_s390_subchannels_ensure(MatchDeviceData *match_data)
 {
-    guint32 a, b, c;
-
     if (G_UNLIKELY(!match_data->s390_subchannels.is_parsed)) {
         match_data->s390_subchannels.is_parsed = TRUE;
 
@@ -1361,7 +1359,16 @@ match_data_s390_subchannels_eval(const char *spec_str, MatchDeviceData *match_da
             match_data->s390_subchannels.value = NULL;
             return FALSE;
         }
-    } else if (!match_data->s390_subchannels.value)
+    }
+    return !!match_data->s390_subchannels.value;
+}
+
+static gboolean
+match_data_s390_subchannels_eval(const char *spec_str, MatchDeviceData *match_data)
+{
+    guint32 a, b, c;
+
+    if (!match_data_s390_subchannels_ensure(match_data))
         return FALSE;
 
     if (!match_device_s390_subchannels_parse(spec_str, &a, &b, &c))
@@ -1371,7 +1378,7 @@ match_data_s390_subchannels_eval(const char *spec_str, MatchDeviceData *match_da
 }
 
 static gboolean
-match_device_hwaddr_eval(const char *spec_str, MatchDeviceData *match_data)
+match_data_hwaddr_ensure(MatchDeviceData *match_data)
 {
     if (G_UNLIKELY(!match_data->hwaddr.is_parsed)) {
         match_data->hwaddr.is_parsed = TRUE;
@@ -1385,9 +1392,15 @@ match_device_hwaddr_eval(const char *spec_str, MatchDeviceData *match_data)
                                        &l))
                 g_return_val_if_reached(FALSE);
             match_data->hwaddr.len = l;
-        } else
-            return FALSE;
-    } else if (!match_data->hwaddr.len)
+        }
+    }
+    return match_data->hwaddr.len > 0;
+}
+
+static gboolean
+match_device_hwaddr_eval(const char *spec_str, MatchDeviceData *match_data)
+{
+    if (!match_data_hwaddr_ensure(match_data))
         return FALSE;
 
     return nm_utils_hwaddr_matches(spec_str, -1, match_data->hwaddr.bin, match_data->hwaddr.len);
@@ -1590,6 +1603,296 @@ nm_match_spec_device(const GSList *specs,
     return _match_result(has_except, has_not_except, has_match, has_match_except);
 }
 
+/*****************************************************************************/
+
+typedef enum {
+    MATCH_DEVICE_ITEM_NONE,
+    MATCH_DEVICE_ITEM_ALL,
+    MATCH_DEVICE_ITEM_DEVICE_TYPE,
+    MATCH_DEVICE_ITEM_HWADDR,
+    MATCH_DEVICE_ITEM_INTERFACE_NAME,
+    MATCH_DEVICE_ITEM_DRIVER,
+    MATCH_DEVICE_ITEM_S390_SUBCHANNELS,
+    MATCH_DEVICE_ITEM_DHCP_PLUGIN,
+    MATCH_DEVICE_ITEM_FUZZY,
+} MatchDeviceItemType;
+
+typedef struct {
+    char *        str;
+    GPatternSpec *pattern;
+    guint         str_len;
+    guint8        type;
+    bool          except : 1;
+    guint8        hwaddr_len;
+    guint8        hwaddr[NM_UTILS_HWADDR_LEN_MAX];
+    guint32       s390_subchannels[3];
+} MatchDeviceItem;
+
+struct _NMMatchSpecDevice {
+    guint           n_items;
+    bool            has_except : 1;
+    bool            has_not_except : 1;
+    MatchDeviceItem items[];
+};
+
+static void
+match_device_item_parse_hwaddr(MatchDeviceItem *item, const char *spec_str)
+{
+    gsize l;
+
+    if (_nm_utils_hwaddr_aton(spec_str, item->hwaddr, sizeof(item->hwaddr), &l))
+        item->hwaddr_len = l;
+}
+
+static void
+match_device_item_init(MatchDeviceItem *item, const char *spec_str, gboolean allow_fuzzy)
+{
+    if (spec_str[0] == '*' && spec_str[1] == '\0') {
+        item->type = MATCH_DEVICE_ITEM_ALL;
+        return;
+    }
+
+    if (_MATCH_CHECK(spec_str, DEVICE_TYPE_TAG)) {
+        item->type = MATCH_DEVICE_ITEM_DEVICE_TYPE;
+        item->str  = g_strdup(spec_str);
+        return;
+    }
+
+    if (_MATCH_CHECK(spec_str, NM_MATCH_SPEC_MAC_TAG)) {
+        item->type = MATCH_DEVICE_ITEM_HWADDR;
+        match_device_item_parse_hwaddr(item, spec_str);
+        return;
+    }
+
+    if (_MATCH_CHECK(spec_str, NM_MATCH_SPEC_INTERFACE_NAME_TAG)) {
+        gboolean use_pattern = FALSE;
+
+        if (spec_str[0] == '=')
+            spec_str += 1;
+        else {
+            if (spec_str[0] == '~')
+                spec_str += 1;
+            use_pattern = TRUE;
+        }
+
+        item->type = MATCH_DEVICE_ITEM_INTERFACE_NAME;
+        item->str  = g_strdup(spec_str);
+
+        /* without wildcards, the glob is the same as the exact match. */
+        if (use_pattern && strpbrk(spec_str, "*?"))
+            item->pattern = g_pattern_spec_new(spec_str);
+        return;
+    }
+
+    if (_MATCH_CHECK(spec_str, DRIVER_TAG)) {
+        const char *t;
+
+        item->type = MATCH_DEVICE_ITEM_DRIVER;
+        item->str  = g_strdup(spec_str);
+
+        /* see match_device_eval() for the supported formats. */
+        t = strrchr(spec_str, '/');
+        if (t) {
+            item->str_len = t - spec_str;
+            item->pattern = g_pattern_spec_new(&t[1]);
+        }
+        return;
+    }
+
+    if (_MATCH_CHECK(spec_str, NM_MATCH_SPEC_S390_SUBCHANNELS_TAG)) {
+        if (match_device_s390_subchannels_parse(spec_str,
+                                                &item->s390_subchannels[0],
+                                                &item->s390_subchannels[1],
+                                                &item->s390_subchannels[2]))
+            item->type = MATCH_DEVICE_ITEM_S390_SUBCHANNELS;
+        return;
+    }
+
+    if (_MATCH_CHECK(spec_str, DHCP_PLUGIN_TAG)) {
+        item->type = MATCH_DEVICE_ITEM_DHCP_PLUGIN;
+        item->str  = g_strdup(spec_str);
+        return;
+    }
+
+    if (allow_fuzzy) {
+        item->type = MATCH_DEVICE_ITEM_FUZZY;
+        item->str  = g_strdup(spec_str);
+        match_device_item_parse_hwaddr(item, spec_str);
+    }
+}
+
+static gboolean
+match_device_item_eval(const MatchDeviceItem *item, MatchDeviceData *match_data)
+{
+    switch ((MatchDeviceItemType) item->type) {
+    case MATCH_DEVICE_ITEM_NONE:
+        return FALSE;
+    case MATCH_DEVICE_ITEM_ALL:
+        return TRUE;
+    case MATCH_DEVICE_ITEM_DEVICE_TYPE:
+        return match_data->device_type && nm_streq(item->str, match_data->device_type);
+    case MATCH_DEVICE_ITEM_HWADDR:
+        return item->hwaddr_len > 0 && match_data_hwaddr_ensure(match_data)
+               && nm_utils_hwaddr_matches(item->hwaddr,
+                                          item->hwaddr_len,
+                                          match_data->hwaddr.bin,
+                                          match_data->hwaddr.len);
+    case MATCH_DEVICE_ITEM_INTERFACE_NAME:
+        return match_data->interface_name
+               && (nm_streq(item->str, match_data->interface_name)
+                   || (item->pattern
+                       && g_pattern_match_string(item->pattern, match_data->interface_name)));
+    case MATCH_DEVICE_ITEM_DRIVER:
+        if (!match_data->driver)
+            return FALSE;
+        if (!item->pattern)
+            return nm_streq(item->str, match_data->driver);
+        return strncmp(item->str, match_data->driver, item->str_len) == 0
+               && g_pattern_match_string(item->pattern, match_data->driver_version ?: "");
+    case MATCH_DEVICE_ITEM_S390_SUBCHANNELS:
+        return match_data_s390_subchannels_ensure(match_data)
+               && match_data->s390_subchannels.a == item->s390_subchannels[0]
+               && match_data->s390_subchannels.b == item->s390_subchannels[1]
+               && match_data->s390_subchannels.c == item->s390_subchannels[2];
+    case MATCH_DEVICE_ITEM_DHCP_PLUGIN:
+        return nm_streq0(item->str, match_data->dhcp_plugin);
+    case MATCH_DEVICE_ITEM_FUZZY:
+        if (item->hwaddr_len > 0 && match_data_hwaddr_ensure(match_data)
+            && nm_utils_hwaddr_matches(item->hwaddr,
+                                       item->hwaddr_len,
+                                       match_data->hwaddr.bin,
+                                       match_data->hwaddr.len))
+            return TRUE;
+        return match_data->interface_name && nm_streq(item->str, match_data->interface_name);
+    }
+    return nm_assert_unreachable_val(FALSE);
+}
+
+/**
+ * nm_match_spec_device_new:
+ * @specs: the list of device match specs.
+ *
+ * Parses @specs once, so that they can be evaluated repeatedly with
+ * nm_match_spec_device_match() without string parsing and glob
+ * compilation on each evaluation.
+ *
+ * Returns: the compiled matcher, or %NULL if @specs contains no
+ *   (non-empty) spec. %NULL is a valid matcher that never matches.
+ */
+NMMatchSpecDevice *
+nm_match_spec_device_new(const GSList *specs)
+{
+    NMMatchSpecDevice *self;
+    const GSList *     iter;
+    guint              n = 0;
+
+    for (iter = specs; iter; iter = iter->next) {
+        const char *spec_str = iter->data;
+
+        if (spec_str && spec_str[0])
+            n++;
+    }
+    if (n == 0)
+        return NULL;
+
+    self          = g_malloc0(sizeof(NMMatchSpecDevice) + (sizeof(MatchDeviceItem) * n));
+    self->n_items = n;
+
+    n = 0;
+    for (iter = specs; iter; iter = iter->next) {
+        MatchDeviceItem *item     = &self->items[n];
+        const char *     spec_str = iter->data;
+        gboolean         except;
+
+        if (!spec_str || !*spec_str)
+            continue;
+
+        spec_str     = match_except(spec_str, &except);
+        item->except = except;
+        if (except)
+            self->has_except = TRUE;
+        else
+            self->has_not_except = TRUE;
+
+        match_device_item_init(item, spec_str, !except);
+        n++;
+    }
+    nm_assert(n == self->n_items);
+
+    return self;
+}
+
+void
+nm_match_spec_device_free(NMMatchSpecDevice *self)
+{
+    guint i;
+
+    if (!self)
+        return;
+
+    for (i = 0; i < self->n_items; i++) {
+        g_free(self->items[i].str);
+        if (self->items[i].pattern)
+            g_pattern_spec_free(self->items[i].pattern);
+    }
+    g_free(self);
+}
+
+/**
+ * nm_match_spec_device_match:
+ * @self: (allow-none): the matcher from nm_match_spec_device_new().
+ * @data: the device properties to match.
+ *
+ * Returns: the same result as nm_match_spec_device() for the specs
+ *   that @self was created from.
+ */
+NMMatchSpecMatchType
+nm_match_spec_device_match(const NMMatchSpecDevice *self, const NMMatchSpecDeviceData *data)
+{
+    gboolean        has_match        = FALSE;
+    gboolean        has_match_except = FALSE;
+    guint           i;
+    MatchDeviceData match_data = {
+        .interface_name = data->interface_name,
+        .device_type    = nm_str_not_empty(data->device_type),
+        .driver         = nm_str_not_empty(data->driver),
+        .driver_version = nm_str_not_empty(data->driver_version),
+        .dhcp_plugin    = nm_str_not_empty(data->dhcp_plugin),
+        .hwaddr =
+            {
+                .value = data->hwaddr,
+            },
+        .s390_subchannels =
+            {
+                .value = data->s390_subchannels,
+            },
+    };
+
+    nm_assert(!data->hwaddr || nm_utils_hwaddr_valid(data->hwaddr, -1));
+
+    if (!self)
+        return NM_MATCH_SPEC_NO_MATCH;
+
+    for (i = 0; i < self->n_items; i++) {
+        const MatchDeviceItem *item = &self->items[i];
+
+        if ((item->except && has_match_except) || (!item->except && has_match)) {
+            /* evaluating the match does not give new information. Skip it. */
+            continue;
+        }
+
+        if (!match_device_item_eval(item, &match_data))
+            continue;
+
+        if (item->except)
+            has_match_except = TRUE;
+        else
+            has_match = TRUE;
+    }
+
+    return _match_result(self->has_except, self->has_not_except, has_match, has_match_except);
+}
+
 static gboolean
 match_config_eval(const char *str, const char *tag, guint cur_nm_version)
 {
@@ -2165,6 +2468,77 @@ nm_utils_cmp_connection_by_autoconnect_priority(NMConnection *a, NMConnection *b
 
 /*****************************************************************************/
 
+static int
+_connections_find_master(NMConnection *const *connections, guint len, guint idx)
+{
+    NMSettingConnection *s_con;
+    const char *         master;
+    guint                i;
+
+    s_con  = nm_connection_get_setting_connection(connections[idx]);
+    master = s_con ? nm_setting_connection_get_master(s_con) : NULL;
+    if (!master)
+        return -1;
+
+    for (i = 0; i < len; i++) {
+        if (i == idx)
+            continue;
+        if (nm_streq0(master, nm_connection_get_uuid(connections[i]))
+            || nm_streq0(master, nm_connection_get_interface_name(connections[i])))
+            return i;
+    }
+    return -1;
+}
+
+/**
+ * nm_utils_connections_activation_order:
+ * @connections: the connections to activate
+ * @len: the number of @connections
+ *
+ * A master must be activated before its slaves. Otherwise, activating the
+ * slave would activate the master on its own, and the activation of the
+ * master in the list would then replace that. A master is found among
+ * @connections by UUID or interface name. Apart from that, the order
+ * is kept.
+ *
+ * Returns: (transfer full): the indexes of @connections in the order in
+ *   which to activate them.
+ */
+guint *
+nm_utils_connections_activation_order(NMConnection *const *connections, guint len)
+{
+    gs_free guint *depths = NULL;
+    guint *        order;
+    guint          depth;
+    guint          n;
+    guint          i;
+
+    depths = g_new0(guint, len);
+    for (i = 0; i < len; i++) {
+        int idx = i;
+
+        while ((idx = _connections_find_master(connections, len, idx)) >= 0) {
+            if (++depths[i] >= len) {
+                /* a cycle. Give up on ordering this one. */
+                depths[i] = 0;
+                break;
+            }
+        }
+    }
+
+    order = g_new(guint, len);
+    n     = 0;
+    for (depth = 0; n < len; depth++) {
+        for (i = 0; i < len; i++) {
+            if (depths[i] == depth)
+                order[n++] = i;
+        }
+    }
+    return order;
+}
+
+/*****************************************************************************/
+
 typedef struct {
     const char *name;
     NMSetting * setting;
@@ -5114,3 +5488,104 @@ NM_UTILS_LOOKUP_STR_DEFINE(nm_activation_type_to_string,
                            NM_UTILS_LOOKUP_STR_ITEM(NM_ACTIVATION_TYPE_MANAGED, "managed"),
                            NM_UTILS_LOOKUP_STR_ITEM(NM_ACTIVATION_TYPE_ASSUME, "assume"),
                            NM_UTILS_LOOKUP_STR_ITEM(NM_ACTIVATION_TYPE_EXTERNAL, "external"), );
+
+/*****************************************************************************/
+
+typedef struct {
+    GSourceFunc func;
+    gpointer    user_data;
+    gint64      scheduled_nsec;
+    NMIdleClass idle_class;
+    bool        dispatched : 1;
+} IdleClassData;
+
+static NMIdleClassStats _idle_class_stats[_NM_IDLE_CLASS_NUM];
+
+static const int _idle_class_priorities[_NM_IDLE_CLASS_NUM] = {
+    [NM_IDLE_CLASS_LINK_CHANGED]     = NM_PRIORITY_IDLE_LINK_CHANGED,
+    [NM_IDLE_CLASS_ACTIVATION_STAGE] = NM_PRIORITY_IDLE_ACTIVATION_STAGE,
+    [NM_IDLE_CLASS_IP_CONFIG]        = NM_PRIORITY_IDLE_IP_CONFIG,
+};
+
+static gboolean
+_idle_class_dispatch(gpointer user_data)
+{
+    IdleClassData *data = user_data;
+
+    if (!data->dispatched) {
+        NMIdleClassStats *stats = &_idle_class_stats[data->idle_class];
+        gint64            wait_nsec;
+
+        wait_nsec = nm_utils_get_monotonic_timestamp_nsec() - data->scheduled_nsec;
+        data->dispatched = TRUE;
+        stats->n_dispatched++;
+        stats->wait_total_nsec += wait_nsec;
+        stats->wait_max_nsec = MAX(stats->wait_max_nsec, wait_nsec);
+    }
+
+    return data->func(data->user_data);
+}
+
+static void
+_idle_class_destroy(gpointer user_data)
+{
+    IdleClassData *data = user_data;
+
+    nm_assert(_idle_class_stats[data->idle_class].n_pending > 0);
+    _idle_class_stats[data->idle_class].n_pending--;
+    g_slice_free(IdleClassData, data);
+}
+
+/**
+ * nm_idle_class_add:
+ * @idle_class: the #NMIdleClass that determines the priority.
+ * @func: the function to call.
+ * @user_data: data passed to @func.
+ *
+ * Like g_idle_add_full() with the priority of @idle_class. Additionally,
+ * count the pending sources of the class and how long they wait before
+ * they are dispatched. See nm_idle_class_get_stats().
+ *
+ * Returns: the ID of the source. Remove it with g_source_remove() or
+ *   nm_clear_g_source() as usual.
+ */
+guint
+nm_idle_class_add(NMIdleClass idle_class, GSourceFunc func, gpointer user_data)
+{
+    IdleClassData *data;
+
+    g_return_val_if_fail((guint) idle_class < _NM_IDLE_CLASS_NUM, 0);
+    g_return_val_if_fail(func, 0);
+
+    data  = g_slice_new(IdleClassData);
+    *data = (IdleClassData){
+        .func           = func,
+        .user_data      = user_data,
+        .scheduled_nsec = nm_utils_get_monotonic_timestamp_nsec(),
+        .idle_class     = idle_class,
+    };
+
+    _idle_class_stats[idle_class].n_pending++;
+
+    return g_idle_add_full(_idle_class_priorities[idle_class],
+                           _idle_class_dispatch,
+                           data,
+                           _idle_class_destroy);
+}
+
+const NMIdleClassStats *
+nm_idle_class_get_stats(NMIdleClass idle_class)
+{
+    g_return_val_if_fail((guint) idle_class < _NM_IDLE_CLASS_NUM, NULL);
+
+    return &_idle_class_stats[idle_class];
+}
+
+NM_UTILS_LOOKUP_STR_DEFINE(nm_idle_class_to_string,
+                           NMIdleClass,
+                           NM_UTILS_LOOKUP_DEFAULT_WARN("(unknown)"),
+                           NM_UTILS_LOOKUP_STR_ITEM(NM_IDLE_CLASS_LINK_CHANGED, "link-changed"),
+                           NM_UTILS_LOOKUP_STR_ITEM(NM_IDLE_CLASS_ACTIVATION_STAGE,
+                                                    "activation-stage"),
+                           NM_UTILS_LOOKUP_STR_ITEM(NM_IDLE_CLASS_IP_CONFIG, "ip-config"),
+                           NM_UTILS_LOOKUP_ITEM_IGNORE(_NM_IDLE_CLASS_NUM), );
@@ -274,6 +274,24 @@ NMMatchSpecMatchType nm_match_spec_device(const GSList *specs,
                                           const char *  hwaddr,
                                           const char *  s390_subchannels,
                                           const char *  dhcp_plugin);
+
+typedef struct {
+    const char *interface_name;
+    const char *device_type;
+    const char *driver;
+    const char *driver_version;
+    const char *hwaddr;
+    const char *s390_subchannels;
+    const char *dhcp_plugin;
+} NMMatchSpecDeviceData;
+
+typedef struct _NMMatchSpecDevice NMMatchSpecDevice;
+
+NMMatchSpecDevice *  nm_match_spec_device_new(const GSList *specs);
+void                 nm_match_spec_device_free(NMMatchSpecDevice *self);
+NMMatchSpecMatchType nm_match_spec_device_match(const NMMatchSpecDevice *    self,
+                                                const NMMatchSpecDeviceData *data);
+
 NMMatchSpecMatchType nm_match_spec_config(const GSList *specs, guint nm_version, const char *env);
 GSList *             nm_match_spec_split(const char *value);
 char *               nm_match_spec_join(GSList *specs);
@@ -296,6 +314,8 @@ const char *nm_utils_new_infiniband_name(char *name, const char *parent_name, in
 
 int nm_utils_cmp_connection_by_autoconnect_priority(NMConnection *a, NMConnection *b);
 
+guint *nm_utils_connections_activation_order(NMConnection *const *connections, guint len);
+
 void nm_utils_log_connection_diff(NMConnection *connection,
                                   NMConnection *diff_base,
                                   guint32       level,
@@ -576,6 +596,32 @@ guint8 nm_wifi_utils_level_to_quality(int val);
 
 /*****************************************************************************/
 
+typedef enum {
+    NM_IDLE_CLASS_LINK_CHANGED,
+    NM_IDLE_CLASS_ACTIVATION_STAGE,
+    NM_IDLE_CLASS_IP_CONFIG,
+    _NM_IDLE_CLASS_NUM,
+} NMIdleClass;
+
+typedef struct {
+    /* the number of scheduled idle sources that were not yet destroyed. */
+    guint n_pending;
+
+    /* the number of sources that were dispatched at least once, and the time
+     * they waited from being scheduled to their first dispatch. */
+    guint64 n_dispatched;
+    gint64  wait_total_nsec;
+    gint64  wait_max_nsec;
+} NMIdleClassStats;
+
+guint nm_idle_class_add(NMIdleClass idle_class, GSourceFunc func, gpointer user_data);
+
+const NMIdleClassStats *nm_idle_class_get_stats(NMIdleClass idle_class);
+
+const char *nm_idle_class_to_string(NMIdleClass idle_class);
+
+/*****************************************************************************/
+
 #define NM_VPN_ROUTE_METRIC_DEFAULT 50
 
 #define NM_UTILS_ERROR_MSG_REQ_AUTH_FAILED "Unable to authenticate the request"
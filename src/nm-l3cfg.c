@@ -179,6 +179,15 @@ typedef struct _NML3CfgPrivate {
 
     guint64 pseudo_timestamp_counter;
 
+    /* Incremented for every platform change notification for our ifindex.
+     * Together with the commited l3cd (which only gets replaced if its content
+     * changes), this allows to detect commits that would not change anything. */
+    guint64 platform_change_generation;
+    guint64 commit_platform_change_generation;
+
+    guint commit_count;
+    guint commit_elided_count;
+
     union {
         struct {
             guint externally_removed_objs_cnt_addresses_6;
@@ -215,8 +224,14 @@ typedef struct _NML3CfgPrivate {
 
     gint8 commit_reentrant_count;
 
+    /* The commit type of the last commit that synced with platform. NM_L3_CFG_COMMIT_TYPE_AUTO
+     * means that we did not commit yet. */
+    NML3CfgCommitType commit_type_last;
+
     bool commit_type_update_sticky : 1;
 
+    bool commit_last_success : 1;
+
     bool acd_is_pending : 1;
 
     bool nacd_acd_not_supported : 1;
@@ -793,6 +808,8 @@ _nm_l3cfg_notify_platform_change(NML3Cfg *                  self,
 
     nm_assert(NMP_OBJECT_IS_VALID(obj));
 
+    self->priv.p->platform_change_generation++;
+
     obj_type = NMP_OBJECT_GET_TYPE(obj);
 
     switch (obj_type) {
@@ -3359,6 +3376,31 @@ _l3_commit_one(NML3Cfg *             self,
     return success;
 }
 
+static gboolean
+_l3_commit_can_elide(NML3Cfg *self, NML3CfgCommitType commit_type, gboolean changed_combined_l3cd)
+{
+    /* A commit that neither has a different configuration nor sees a platform
+     * change since the last commit, would not change anything. This is common
+     * for periodic updates (like DHCP renewals) that result in the same configuration. */
+
+    if (commit_type == NM_L3_CFG_COMMIT_TYPE_REAPPLY)
+        return FALSE;
+    if (commit_type != self->priv.p->commit_type_last)
+        return FALSE;
+    if (!self->priv.p->commit_last_success)
+        return FALSE;
+    if (changed_combined_l3cd)
+        return FALSE;
+    if (self->priv.p->platform_change_generation
+        != self->priv.p->commit_platform_change_generation)
+        return FALSE;
+    if (nm_g_hash_table_size(self->priv.p->routes_temporary_not_available_hash) > 0) {
+        /* we need to retry adding these routes. */
+        return FALSE;
+    }
+    return TRUE;
+}
+
 static void
 _l3_commit(NML3Cfg *self, NML3CfgCommitType commit_type, gboolean is_idle)
 {
@@ -3366,6 +3408,7 @@ _l3_commit(NML3Cfg *self, NML3CfgCommitType commit_type, gboolean is_idle)
     gboolean                                 commit_type_detected = FALSE;
     char                                     sbuf_ct[30];
     gboolean                                 changed_combined_l3cd;
+    gboolean                                 success;
 
     g_return_if_fail(NM_IS_L3CFG(self));
     nm_assert(NM_IN_SET(commit_type,
@@ -3421,10 +3464,26 @@ _l3_commit(NML3Cfg *self, NML3CfgCommitType commit_type, gboolean is_idle)
                                   &l3cd_old,
                                   &changed_combined_l3cd);
 
-    /* FIXME(l3cfg): handle items currently not configurable in kernel. */
+    self->priv.p->commit_count++;
+
+    if (_l3_commit_can_elide(self, commit_type, changed_combined_l3cd)) {
+        self->priv.p->commit_elided_count++;
+        _LOGT("commit %s: no changes since last commit, skip (%u of %u commits elided)",
+              _l3_cfg_commit_type_to_string(commit_type, sbuf_ct, sizeof(sbuf_ct)),
+              self->priv.p->commit_elided_count,
+              self->priv.p->commit_count);
+    } else {
+        /* FIXME(l3cfg): handle items currently not configurable in kernel. */
+
+        success = _l3_commit_one(self, AF_INET, commit_type, changed_combined_l3cd, l3cd_old);
+        if (!_l3_commit_one(self, AF_INET6, commit_type, changed_combined_l3cd, l3cd_old))
+            success = FALSE;
 
-    _l3_commit_one(self, AF_INET, commit_type, changed_combined_l3cd, l3cd_old);
-    _l3_commit_one(self, AF_INET6, commit_type, changed_combined_l3cd, l3cd_old);
+        /* The changes that we just did ourselves, are already accounted for. */
+        self->priv.p->commit_platform_change_generation = self->priv.p->platform_change_generation;
+        self->priv.p->commit_type_last                  = commit_type;
+        self->priv.p->commit_last_success               = success;
+    }
 
     _l3_acd_data_process_changes(self);
 
@@ -3440,6 +3499,23 @@ nm_l3cfg_commit(NML3Cfg *self, NML3CfgCommitType commit_type)
     _l3_commit(self, commit_type, FALSE);
 }
 
+/**
+ * nm_l3cfg_get_commit_stats:
+ * @self: the #NML3Cfg instance
+ * @out_commit_count: (allow-none): the number of commits so far.
+ * @out_elided_count: (allow-none): how many of these commits were skipped,
+ *   because neither the configuration nor platform changed since the
+ *   last commit.
+ */
+void
+nm_l3cfg_get_commit_stats(NML3Cfg *self, guint *out_commit_count, guint *out_elided_count)
+{
+    g_return_if_fail(NM_IS_L3CFG(self));
+
+    NM_SET_OUT(out_commit_count, self->priv.p->commit_count);
+    NM_SET_OUT(out_elided_count, self->priv.p->commit_elided_count);
+}
+
 /*****************************************************************************/
 
 NML3CfgCommitType
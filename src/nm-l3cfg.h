@@ -316,6 +316,8 @@ void nm_l3cfg_commit(NML3Cfg *self, NML3CfgCommitType commit_type);
 
 void nm_l3cfg_commit_on_idle_schedule(NML3Cfg *self);
 
+void nm_l3cfg_get_commit_stats(NML3Cfg *self, guint *out_commit_count, guint *out_elided_count);
+
 /*****************************************************************************/
 
 const NML3AcdAddrInfo *nm_l3cfg_get_acd_addr_info(NML3Cfg *self, in_addr_t addr);
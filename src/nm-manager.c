@@ -68,6 +68,7 @@ typedef struct {
 typedef enum {
     ASYNC_OP_TYPE_AC_AUTH_ACTIVATE_INTERNAL,
     ASYNC_OP_TYPE_AC_AUTH_ACTIVATE_USER,
+    ASYNC_OP_TYPE_AC_AUTH_ACTIVATE_USER_BATCH,
     ASYNC_OP_TYPE_AC_AUTH_ADD_AND_ACTIVATE,
     ASYNC_OP_TYPE_AC_AUTH_ADD_AND_ACTIVATE2,
 } AsyncOpType;
@@ -487,6 +488,36 @@ _async_op_data_new_ac_auth_activate_user(NMManager *            self,
     return async_op_data;
 }
 
+/* The entries of ActivateConnections() are authorized together by one
+ * NMAuthChain. Like for ActivateConnection(), they are tracked as pending
+ * operations until then, so that active_connection_find() sees them. */
+static AsyncOpData *
+_async_op_data_new_ac_auth_activate_user_batch(NMManager *self, NMActiveConnection *active_take)
+{
+    AsyncOpData *async_op_data;
+
+    async_op_data                 = g_slice_new0(AsyncOpData);
+    async_op_data->async_op_type  = ASYNC_OP_TYPE_AC_AUTH_ACTIVATE_USER_BATCH;
+    async_op_data->self           = g_object_ref(self);
+    async_op_data->ac_auth.active = active_take;
+    c_list_link_tail(&NM_MANAGER_GET_PRIVATE(self)->async_op_lst_head,
+                     &async_op_data->async_op_lst);
+    return async_op_data;
+}
+
+static void
+_async_op_data_free_ac_auth_activate_user_batch(gpointer data)
+{
+    AsyncOpData *async_op_data = data;
+
+    nm_assert(async_op_data->async_op_type == ASYNC_OP_TYPE_AC_AUTH_ACTIVATE_USER_BATCH);
+
+    c_list_unlink(&async_op_data->async_op_lst);
+    g_object_unref(async_op_data->ac_auth.active);
+    g_object_unref(async_op_data->self);
+    g_slice_free(AsyncOpData, async_op_data);
+}
+
 static AsyncOpData *
 _async_op_data_new_ac_auth_add_and_activate(NMManager *                     self,
                                             AsyncOpType                     async_op_type,
@@ -5483,28 +5514,25 @@ fail:
     g_dbus_method_invocation_take_error(invocation, error);
 }
 
-static void
-impl_manager_activate_connection(NMDBusObject *                     obj,
-                                 const NMDBusInterfaceInfoExtended *interface_info,
-                                 const NMDBusMethodInfoExtended *   method_info,
-                                 GDBusConnection *                  dbus_connection,
-                                 const char *                       sender,
-                                 GDBusMethodInvocation *            invocation,
-                                 GVariant *                         parameters)
-{
-    NMManager *       self                     = NM_MANAGER(obj);
-    NMManagerPrivate *priv                     = NM_MANAGER_GET_PRIVATE(self);
-    gs_unref_object NMActiveConnection *active = NULL;
-    gs_unref_object NMAuthSubject *subject     = NULL;
-    NMSettingsConnection *         sett_conn   = NULL;
-    NMDevice *                     device      = NULL;
-    gboolean                       is_vpn      = FALSE;
-    GError *                       error       = NULL;
-    const char *                   connection_path;
-    const char *                   device_path;
-    const char *                   specific_object_path;
-
-    g_variant_get(parameters, "(&o&o&o)", &connection_path, &device_path, &specific_object_path);
+static NMActiveConnection *
+_activate_connection_new_from_paths(NMManager *            self,
+                                    GDBusMethodInvocation *invocation,
+                                    const char *           connection_path,
+                                    const char *           device_path,
+                                    const char *           specific_object_path,
+                                    NMSettingsConnection **out_sett_conn,
+                                    NMAuthSubject **       out_subject,
+                                    GError **              error)
+{
+    NMManagerPrivate *             priv      = NM_MANAGER_GET_PRIVATE(self);
+    gs_unref_object NMAuthSubject *subject   = NULL;
+    NMSettingsConnection *         sett_conn = NULL;
+    NMDevice *                     device    = NULL;
+    gboolean                       is_vpn    = FALSE;
+    NMActiveConnection *           active;
+
+    *out_sett_conn = NULL;
+    *out_subject   = NULL;
 
     connection_path      = nm_dbus_path_not_empty(connection_path);
     specific_object_path = nm_dbus_path_not_empty(specific_object_path);
@@ -5518,34 +5546,38 @@ impl_manager_activate_connection(NMDBusObject *                     obj,
     if (connection_path) {
         sett_conn = nm_settings_get_connection_by_path(priv->settings, connection_path);
         if (!sett_conn) {
-            error = g_error_new_literal(NM_MANAGER_ERROR,
-                                        NM_MANAGER_ERROR_UNKNOWN_CONNECTION,
-                                        "Connection could not be found.");
-            goto error;
+            g_set_error_literal(error,
+                                NM_MANAGER_ERROR,
+                                NM_MANAGER_ERROR_UNKNOWN_CONNECTION,
+                                "Connection could not be found.");
+            return NULL;
         }
     } else {
         /* If no connection is given, find a suitable connection for the given device path */
         if (!device_path) {
-            error = g_error_new_literal(
-                NM_MANAGER_ERROR,
-                NM_MANAGER_ERROR_UNKNOWN_DEVICE,
-                "Only devices may be activated without a specifying a connection");
-            goto error;
+            g_set_error_literal(error,
+                                NM_MANAGER_ERROR,
+                                NM_MANAGER_ERROR_UNKNOWN_DEVICE,
+                                "Only devices may be activated without a specifying a connection");
+            return NULL;
         }
         device = nm_manager_get_device_by_path(self, device_path);
         if (!device) {
-            error = g_error_new(NM_MANAGER_ERROR,
-                                NM_MANAGER_ERROR_UNKNOWN_DEVICE,
-                                "Can not activate an unknown device '%s'",
-                                device_path);
-            goto error;
+            g_set_error(error,
+                        NM_MANAGER_ERROR,
+                        NM_MANAGER_ERROR_UNKNOWN_DEVICE,
+                        "Can not activate an unknown device '%s'",
+                        device_path);
+            return NULL;
         }
 
-        sett_conn = nm_device_get_best_connection(device, specific_object_path, &error);
+        sett_conn = nm_device_get_best_connection(device, specific_object_path, error);
         if (!sett_conn)
-            goto error;
+            return NULL;
     }
 
+    *out_sett_conn = sett_conn;
+
     subject = validate_activation_request(self,
                                           invocation,
                                           sett_conn,
@@ -5553,9 +5585,9 @@ impl_manager_activate_connection(NMDBusObject *                     obj,
                                           device_path,
                                           &device,
                                           &is_vpn,
-                                          &error);
+                                          error);
     if (!subject)
-        goto error;
+        return NULL;
 
     active = _new_active_connection(self,
                                     is_vpn,
@@ -5568,7 +5600,40 @@ impl_manager_activate_connection(NMDBusObject *                     obj,
                                     NM_ACTIVATION_TYPE_MANAGED,
                                     NM_ACTIVATION_REASON_USER_REQUEST,
                                     _activation_bind_lifetime_to_profile_visibility(subject),
-                                    &error);
+                                    error);
+
+    *out_subject = g_steal_pointer(&subject);
+    return active;
+}
+
+static void
+impl_manager_activate_connection(NMDBusObject *                     obj,
+                                 const NMDBusInterfaceInfoExtended *interface_info,
+                                 const NMDBusMethodInfoExtended *   method_info,
+                                 GDBusConnection *                  dbus_connection,
+                                 const char *                       sender,
+                                 GDBusMethodInvocation *            invocation,
+                                 GVariant *                         parameters)
+{
+    NMManager *     self                       = NM_MANAGER(obj);
+    gs_unref_object NMActiveConnection *active = NULL;
+    gs_unref_object NMAuthSubject *subject     = NULL;
+    NMSettingsConnection *         sett_conn   = NULL;
+    GError *                       error       = NULL;
+    const char *                   connection_path;
+    const char *                   device_path;
+    const char *                   specific_object_path;
+
+    g_variant_get(parameters, "(&o&o&o)", &connection_path, &device_path, &specific_object_path);
+
+    active = _activate_connection_new_from_paths(self,
+                                                 invocation,
+                                                 connection_path,
+                                                 device_path,
+                                                 specific_object_path,
+                                                 &sett_conn,
+                                                 &subject,
+                                                 &error);
     if (!active)
         goto error;
 
@@ -5597,6 +5662,204 @@ error:
 
 /*****************************************************************************/
 
+static void
+activate_connections_auth_done_cb(NMAuthChain *          chain,
+                                  GDBusMethodInvocation *invocation,
+                                  gpointer               user_data)
+{
+    NMManager *            self        = NM_MANAGER(user_data);
+    GPtrArray *            ops         = nm_auth_chain_get_data(chain, "ops");
+    NMAuthSubject *        subject     = nm_auth_chain_get_subject(chain);
+    gs_free NMConnection **connections = NULL;
+    gs_free guint *        order       = NULL;
+    gs_free const char **  paths       = NULL;
+    gs_free_error GError *error        = NULL;
+    const char *           permission;
+    guint                  i;
+
+    nm_assert(G_IS_DBUS_METHOD_INVOCATION(invocation));
+
+    c_list_unlink(nm_auth_chain_parent_lst_list(chain));
+
+    /* the activations are no longer pending. The chain frees @ops. */
+    connections = g_new(NMConnection *, ops->len);
+    for (i = 0; i < ops->len; i++) {
+        AsyncOpData *async_op_data = ops->pdata[i];
+
+        c_list_unlink(&async_op_data->async_op_lst);
+        connections[i] = nm_active_connection_get_applied_connection(async_op_data->ac_auth.active);
+    }
+
+    if (nm_auth_chain_get_result(chain, NM_AUTH_PERMISSION_NETWORK_CONTROL)
+        != NM_AUTH_CALL_RESULT_YES) {
+        error = g_error_new_literal(NM_MANAGER_ERROR,
+                                    NM_MANAGER_ERROR_PERMISSION_DENIED,
+                                    "Not authorized to control networking.");
+    } else {
+        for (i = 0; i < ops->len; i++) {
+            permission = nm_utils_get_shared_wifi_permission(connections[i]);
+            if (permission
+                && nm_auth_chain_get_result(chain, permission) != NM_AUTH_CALL_RESULT_YES) {
+                error = g_error_new_literal(NM_MANAGER_ERROR,
+                                            NM_MANAGER_ERROR_PERMISSION_DENIED,
+                                            "Not authorized to share connections via wifi.");
+                break;
+            }
+        }
+    }
+
+    if (error) {
+        for (i = 0; i < ops->len; i++) {
+            NMActiveConnection *  active    = ((AsyncOpData *) ops->pdata[i])->ac_auth.active;
+            NMSettingsConnection *sett_conn = nm_active_connection_get_settings_connection(active);
+
+            _delete_volatile_connection_do(self, sett_conn);
+            nm_audit_log_connection_op(NM_AUDIT_OP_CONN_ACTIVATE,
+                                       sett_conn,
+                                       FALSE,
+                                       NULL,
+                                       subject,
+                                       error->message);
+            nm_active_connection_set_state_fail(active,
+                                                NM_ACTIVE_CONNECTION_STATE_REASON_UNKNOWN,
+                                                error->message);
+        }
+        g_dbus_method_invocation_return_gerror(invocation, error);
+        return;
+    }
+
+    order = nm_utils_connections_activation_order(connections, ops->len);
+
+    paths = g_new(const char *, ops->len + 1);
+    for (i = 0; i < ops->len; i++) {
+        guint                 idx       = order[i];
+        NMActiveConnection *  active    = ((AsyncOpData *) ops->pdata[idx])->ac_auth.active;
+        NMSettingsConnection *sett_conn = nm_active_connection_get_settings_connection(active);
+        gs_free_error GError *local     = NULL;
+
+        if (!_internal_activate_generic(self, active, &local)) {
+            _delete_volatile_connection_do(self, sett_conn);
+            nm_audit_log_connection_op(NM_AUDIT_OP_CONN_ACTIVATE,
+                                       sett_conn,
+                                       FALSE,
+                                       NULL,
+                                       subject,
+                                       local->message);
+            nm_active_connection_set_state_fail(active,
+                                                NM_ACTIVE_CONNECTION_STATE_REASON_UNKNOWN,
+                                                local->message);
+            paths[idx] = "/";
+            continue;
+        }
+
+        nm_settings_connection_autoconnect_blocked_reason_set(
+            sett_conn,
+            NM_SETTINGS_AUTO_CONNECT_BLOCKED_REASON_USER_REQUEST,
+            FALSE);
+        nm_audit_log_connection_op(NM_AUDIT_OP_CONN_ACTIVATE, sett_conn, TRUE, NULL, subject, NULL);
+        paths[idx] = nm_dbus_object_get_path(NM_DBUS_OBJECT(active));
+    }
+    paths[ops->len] = NULL;
+
+    g_dbus_method_invocation_return_value(invocation, g_variant_new("(^ao)", paths));
+}
+
+static void
+impl_manager_activate_connections(NMDBusObject *                     obj,
+                                  const NMDBusInterfaceInfoExtended *interface_info,
+                                  const NMDBusMethodInfoExtended *   method_info,
+                                  GDBusConnection *                  dbus_connection,
+                                  const char *                       sender,
+                                  GDBusMethodInvocation *            invocation,
+                                  GVariant *                         parameters)
+{
+    NMManager *                    self    = NM_MANAGER(obj);
+    NMManagerPrivate *             priv    = NM_MANAGER_GET_PRIVATE(self);
+    gs_unref_ptrarray GPtrArray *ops       = NULL;
+    gs_unref_variant GVariant *entries     = NULL;
+    gs_unref_hashtable GHashTable *perms   = NULL;
+    gs_unref_object NMAuthSubject *subject = NULL;
+    NMAuthChain *                  chain;
+    GError *                       error = NULL;
+    GHashTableIter                 h_iter;
+    const char *                   permission;
+    gsize                          n_entries;
+    gsize                          i;
+
+    g_variant_get(parameters, "(@a(ooo))", &entries);
+
+    n_entries = g_variant_n_children(entries);
+    if (n_entries == 0) {
+        g_dbus_method_invocation_return_error_literal(invocation,
+                                                      NM_MANAGER_ERROR,
+                                                      NM_MANAGER_ERROR_INVALID_ARGUMENTS,
+                                                      "No connections given");
+        return;
+    }
+
+    /* Validate all requests before starting any of them. Either all
+     * activations are started, or none. */
+    ops   = g_ptr_array_new_full(n_entries, _async_op_data_free_ac_auth_activate_user_batch);
+    perms = g_hash_table_new(nm_str_hash, g_str_equal);
+    for (i = 0; i < n_entries; i++) {
+        gs_unref_object NMAuthSubject *entry_subject = NULL;
+        NMSettingsConnection *         sett_conn     = NULL;
+        NMActiveConnection *           active;
+        const char *                   connection_path;
+        const char *                   device_path;
+        const char *                   specific_object_path;
+
+        g_variant_get_child(entries,
+                            i,
+                            "(&o&o&o)",
+                            &connection_path,
+                            &device_path,
+                            &specific_object_path);
+
+        active = _activate_connection_new_from_paths(self,
+                                                     invocation,
+                                                     connection_path,
+                                                     device_path,
+                                                     specific_object_path,
+                                                     &sett_conn,
+                                                     &entry_subject,
+                                                     &error);
+        if (!active) {
+            if (sett_conn) {
+                nm_audit_log_connection_op(NM_AUDIT_OP_CONN_ACTIVATE,
+                                           sett_conn,
+                                           FALSE,
+                                           NULL,
+                                           entry_subject,
+                                           error->message);
+            }
+            g_prefix_error(&error, "connection #%u: ", (guint) i);
+            g_dbus_method_invocation_take_error(invocation, error);
+            return;
+        }
+        g_ptr_array_add(ops, _async_op_data_new_ac_auth_activate_user_batch(self, active));
+
+        if (!subject)
+            subject = g_steal_pointer(&entry_subject);
+
+        permission = nm_utils_get_shared_wifi_permission(
+            nm_active_connection_get_applied_connection(active));
+        if (permission)
+            g_hash_table_add(perms, (gpointer) permission);
+    }
+
+    /* Authorize once for the whole batch. */
+    chain = nm_auth_chain_new_subject(subject, invocation, activate_connections_auth_done_cb, self);
+    c_list_link_tail(&priv->auth_lst_head, nm_auth_chain_parent_lst_list(chain));
+    nm_auth_chain_set_data(chain, "ops", g_steal_pointer(&ops), (GDestroyNotify) g_ptr_array_unref);
+    nm_auth_chain_add_call(chain, NM_AUTH_PERMISSION_NETWORK_CONTROL, TRUE);
+    g_hash_table_iter_init(&h_iter, perms);
+    while (g_hash_table_iter_next(&h_iter, (gpointer *) &permission, NULL))
+        nm_auth_chain_add_call_unsafe(chain, permission, TRUE);
+}
+
+/*****************************************************************************/
+
 static void
 activation_add_done(NMSettings *           settings,
                     NMSettingsConnection * new_connection,
@@ -6597,6 +6860,110 @@ impl_manager_set_logging(NMDBusObject *                     obj,
         g_dbus_method_invocation_return_value(invocation, NULL);
 }
 
+static GVariant *
+_platform_stats_histogram_to_variant(const NMPlatformStatsHistogram *hist)
+{
+    return g_variant_new("(ttt@at)",
+                         (guint64) hist->count,
+                         (guint64) hist->sum_usec,
+                         (guint64) hist->max_usec,
+                         g_variant_new_fixed_array(G_VARIANT_TYPE_UINT64,
+                                                   hist->buckets,
+                                                   G_N_ELEMENTS(hist->buckets),
+                                                   sizeof(hist->buckets[0])));
+}
+
+static void
+impl_manager_get_platform_stats(NMDBusObject *                     obj,
+                                const NMDBusInterfaceInfoExtended *interface_info,
+                                const NMDBusMethodInfoExtended *   method_info,
+                                GDBusConnection *                  connection,
+                                const char *                       sender,
+                                GDBusMethodInvocation *            invocation,
+                                GVariant *                         parameters)
+{
+    NMManager *            self = NM_MANAGER(obj);
+    NMManagerPrivate *     priv = NM_MANAGER_GET_PRIVATE(self);
+    const NMPlatformStats *stats;
+    GVariantBuilder        builder;
+    GVariantBuilder        builder_msgs;
+    GHashTableIter         h_iter;
+    gpointer               h_key;
+    gpointer               h_value;
+    guint                  i;
+
+    stats = nm_platform_get_stats(priv->platform);
+    if (!stats) {
+        g_dbus_method_invocation_return_error_literal(invocation,
+                                                      NM_MANAGER_ERROR,
+                                                      NM_MANAGER_ERROR_FAILED,
+                                                      "Platform statistics are not available");
+        return;
+    }
+
+    g_variant_builder_init(&builder, G_VARIANT_TYPE_VARDICT);
+
+    g_variant_builder_init(&builder_msgs, G_VARIANT_TYPE("a{st}"));
+    for (i = 0; i < G_N_ELEMENTS(stats->msgs_by_type); i++) {
+        const char *type_str;
+        char        sbuf[30];
+
+        if (stats->msgs_by_type[i] == 0)
+            continue;
+        type_str = nm_platform_stats_msg_type_to_string(i, sbuf, sizeof(sbuf));
+        g_variant_builder_add(&builder_msgs, "{st}", type_str, (guint64) stats->msgs_by_type[i]);
+    }
+    if (stats->msgs_other > 0)
+        g_variant_builder_add(&builder_msgs, "{st}", "other", (guint64) stats->msgs_other);
+    g_variant_builder_add(&builder, "{sv}", "messages", g_variant_builder_end(&builder_msgs));
+
+    g_variant_builder_init(&builder_msgs, G_VARIANT_TYPE("a{it}"));
+    if (stats->msgs_by_ifindex) {
+        g_hash_table_iter_init(&h_iter, stats->msgs_by_ifindex);
+        while (g_hash_table_iter_next(&h_iter, &h_key, &h_value)) {
+            g_variant_builder_add(&builder_msgs,
+                                  "{it}",
+                                  (gint32) GPOINTER_TO_INT(h_key),
+                                  (guint64) GPOINTER_TO_SIZE(h_value));
+        }
+    }
+    g_variant_builder_add(&builder,
+                          "{sv}",
+                          "messages-by-ifindex",
+                          g_variant_builder_end(&builder_msgs));
+
+    g_variant_builder_add(&builder,
+                          "{sv}",
+                          "parse",
+                          _platform_stats_histogram_to_variant(&stats->parse));
+    g_variant_builder_add(&builder,
+                          "{sv}",
+                          "cache-update",
+                          _platform_stats_histogram_to_variant(&stats->cache_update));
+    g_variant_builder_add(&builder,
+                          "{sv}",
+                          "ack-wait",
+                          _platform_stats_histogram_to_variant(&stats->ack_wait));
+    g_variant_builder_add(&builder, "{sv}", "resyncs", g_variant_new_uint64(stats->resyncs));
+    g_variant_builder_add(&builder, "{sv}", "overflows", g_variant_new_uint64(stats->overflows));
+
+    g_variant_builder_init(&builder_msgs, G_VARIANT_TYPE("a{s(uttt)}"));
+    for (i = 0; i < _NM_IDLE_CLASS_NUM; i++) {
+        const NMIdleClassStats *idle_stats = nm_idle_class_get_stats(i);
+
+        g_variant_builder_add(&builder_msgs,
+                              "{s(uttt)}",
+                              nm_idle_class_to_string(i),
+                              (guint32) idle_stats->n_pending,
+                              (guint64) idle_stats->n_dispatched,
+                              (guint64) (idle_stats->wait_total_nsec / 1000),
+                              (guint64) (idle_stats->wait_max_nsec / 1000));
+    }
+    g_variant_builder_add(&builder, "{sv}", "idle-classes", g_variant_builder_end(&builder_msgs));
+
+    g_dbus_method_invocation_return_value(invocation, g_variant_new("(a{sv})", &builder));
+}
+
 static void
 impl_manager_get_logging(NMDBusObject *                     obj,
                          const NMDBusInterfaceInfoExtended *interface_info,
@@ -8176,6 +8543,14 @@ static const NMDBusInterfaceInfoExtended interface_info_manager = {
                     .out_args = NM_DEFINE_GDBUS_ARG_INFOS(
                         NM_DEFINE_GDBUS_ARG_INFO("active_connection", "o"), ), ),
                 .handle = impl_manager_activate_connection, ),
+            NM_DEFINE_DBUS_METHOD_INFO_EXTENDED(
+                NM_DEFINE_GDBUS_METHOD_INFO_INIT(
+                    "ActivateConnections",
+                    .in_args = NM_DEFINE_GDBUS_ARG_INFOS(
+                        NM_DEFINE_GDBUS_ARG_INFO("connections", "a(ooo)"), ),
+                    .out_args = NM_DEFINE_GDBUS_ARG_INFOS(
+                        NM_DEFINE_GDBUS_ARG_INFO("active_connections", "ao"), ), ),
+                .handle = impl_manager_activate_connections, ),
             NM_DEFINE_DBUS_METHOD_INFO_EXTENDED(
                 NM_DEFINE_GDBUS_METHOD_INFO_INIT(
                     "AddAndActivateConnection",
@@ -8234,6 +8609,12 @@ static const NMDBusInterfaceInfoExtended interface_info_manager = {
                                                      NM_DEFINE_GDBUS_ARG_INFO("level", "s"),
                                                      NM_DEFINE_GDBUS_ARG_INFO("domains", "s"), ), ),
                 .handle = impl_manager_get_logging, ),
+            NM_DEFINE_DBUS_METHOD_INFO_EXTENDED(
+                NM_DEFINE_GDBUS_METHOD_INFO_INIT(
+                    "GetPlatformStats",
+                    .out_args = NM_DEFINE_GDBUS_ARG_INFOS(
+                        NM_DEFINE_GDBUS_ARG_INFO("stats", "a{sv}"), ), ),
+                .handle = impl_manager_get_platform_stats, ),
             NM_DEFINE_DBUS_METHOD_INFO_EXTENDED(
                 NM_DEFINE_GDBUS_METHOD_INFO_INIT(
                     "CheckConnectivity",
@@ -236,7 +236,8 @@ _platform_signal_cb(NMPlatform *  platform,
     if (c_list_is_empty(&l3cfg_data->signal_pending_lst)) {
         c_list_link_tail(&priv->l3cfg_signal_pending_lst_head, &l3cfg_data->signal_pending_lst);
         if (priv->signal_pending_idle_id == 0)
-            priv->signal_pending_idle_id = g_idle_add(_platform_signal_on_idle_cb, self);
+            priv->signal_pending_idle_id =
+                nm_idle_class_add(NM_IDLE_CLASS_IP_CONFIG, _platform_signal_on_idle_cb, self);
     }
 
     _nm_l3cfg_notify_platform_change(l3cfg_data->l3cfg,
@@ -221,6 +221,7 @@ typedef enum {
 
     NMP_OBJECT_TYPE_TFILTER,
 
+    NMP_OBJECT_TYPE_LNK_BOND,
     NMP_OBJECT_TYPE_LNK_BRIDGE,
     NMP_OBJECT_TYPE_LNK_GRE,
     NMP_OBJECT_TYPE_LNK_GRETAP,
@@ -300,4 +301,16 @@ typedef struct _NMUtilsIPv6IfaceId NMUtilsIPv6IfaceId;
 
 #define NM_SETTING_CONNECTION_MDNS_UNKNOWN ((NMSettingConnectionMdns) -42)
 
+/*****************************************************************************/
+
+/* Priorities of the idle handlers that react to platform changes and drive
+ * activation. GLib only dispatches the most urgent ready sources in each
+ * main loop iteration, so with many devices a backlog of IP configuration
+ * updates cannot delay handling of link changes (like carrier loss).
+ * Schedule them with nm_idle_class_add(), which also keeps statistics per
+ * class. */
+#define NM_PRIORITY_IDLE_LINK_CHANGED     (G_PRIORITY_DEFAULT_IDLE - 10)
+#define NM_PRIORITY_IDLE_ACTIVATION_STAGE G_PRIORITY_DEFAULT_IDLE
+#define NM_PRIORITY_IDLE_IP_CONFIG        (G_PRIORITY_DEFAULT_IDLE + 10)
+
 #endif /* NM_TYPES_H */
@@ -395,19 +395,27 @@ typedef enum {
     DELAYED_ACTION_RESPONSE_TYPE_VOID                    = 0,
     DELAYED_ACTION_RESPONSE_TYPE_REFRESH_ALL_IN_PROGRESS = 1,
     DELAYED_ACTION_RESPONSE_TYPE_ROUTE_GET               = 2,
+    DELAYED_ACTION_RESPONSE_TYPE_BRIDGE_VLANS_GET        = 3,
 } DelayedActionWaitForNlResponseType;
 
+typedef struct {
+    int     ifindex;
+    GArray *vlans;
+} BridgeVlansGetData;
+
 typedef struct {
     guint32                            seq_number;
     WaitForNlResponseResult            seq_result;
     DelayedActionWaitForNlResponseType response_type;
+    gint64                             start_ns;
     gint64                             timeout_abs_ns;
     WaitForNlResponseResult *          out_seq_result;
     char **                            out_errmsg;
     union {
         int *       out_refresh_all_in_progress;
-        NMPObject **out_route_get;
-        gpointer    out_data;
+        NMPObject **        out_route_get;
+        BridgeVlansGetData *out_bridge_vlans_get;
+        gpointer            out_data;
     } response;
 } DelayedActionWaitForNlResponseData;
 
@@ -416,6 +424,10 @@ typedef struct {
 typedef struct {
     struct nl_sock *genl;
 
+    /* the generic netlink family id of "ethtool". Zero if not yet
+     * resolved, negative if kernel does not support it. */
+    int ethtool_family_id;
+
     struct nl_sock *nlh;
 
     GSource *event_source;
@@ -431,6 +443,9 @@ typedef struct {
     GHashTable *sysctl_get_prev_values;
     CList       sysctl_list;
 
+    /* runs the sysctl_set_async() requests, one at a time. */
+    GThreadPool *sysctl_async_pool;
+
     NMUdevClient *udev_client;
 
     struct {
@@ -448,6 +463,8 @@ typedef struct {
 
         int is_handling;
     } delayed_action;
+
+    NMPlatformStats stats;
 } NMLinuxPlatformPrivate;
 
 struct _NMLinuxPlatform {
@@ -1042,7 +1059,10 @@ _linktype_get_type(NMPlatform *      platform,
                    const NMPObject **link_cached,
                    const char **     out_kind)
 {
-    NMLinkType link_type;
+    struct udev_device *udevice      = NULL;
+    gs_free char *      devtype_free = NULL;
+    const char *        devtype      = NULL;
+    NMLinkType          link_type;
 
     NMTST_ASSERT_PLATFORM_NETNS_CURRENT(platform);
     nm_assert(ifname);
@@ -1103,27 +1123,32 @@ _linktype_get_type(NMPlatform *      platform,
     else if (arptype == ARPHRD_6LOWPAN)
         return NM_LINK_TYPE_6LOWPAN;
 
-    {
-        NMPUtilsEthtoolDriverInfo driver_info;
+    if (completed_from_cache) {
+        const NMPObject *obj;
 
-        /* Fallback OVS detection for kernel <= 3.16 */
-        if (nmp_utils_ethtool_get_driver_info(ifindex, &driver_info)) {
-            if (nm_streq(driver_info.driver, "openvswitch"))
-                return NM_LINK_TYPE_OPENVSWITCH;
+        /* If udev already announced the device, it provides the DEVTYPE
+         * and the driver name. Use them instead of probing sysfs and ethtool. */
+        obj = _lookup_cached_link(cache, ifindex, completed_from_cache, link_cached);
+        if (obj && obj->_link.udev.device
+            && nm_streq0(udev_device_get_sysname(obj->_link.udev.device), ifname))
+            udevice = obj->_link.udev.device;
+    }
 
-            if (arptype == 256) {
-                /* Some s390 CTC-type devices report 256 for the encapsulation type
-                 * for some reason, but we need to call them Ethernet.
-                 */
-                if (nm_streq(driver_info.driver, "ctcm"))
-                    return NM_LINK_TYPE_ETHERNET;
-            }
+    if (udevice) {
+        devtype = udev_device_get_devtype(udevice);
+        if (devtype) {
+            link_type = _link_type_from_devtype(devtype);
+
+            /* "wlan" might still be an OLPC mesh device, which we can only
+             * tell apart via sysfs below. */
+            if (!NM_IN_SET(link_type, NM_LINK_TYPE_NONE, NM_LINK_TYPE_WIFI)
+                && (link_type != NM_LINK_TYPE_BNEP || arptype == ARPHRD_ETHER))
+                return link_type;
         }
     }
 
     {
-        nm_auto_close int dirfd   = -1;
-        gs_free char *    devtype = NULL;
+        nm_auto_close int dirfd = -1;
         char              ifname_verified[IFNAMSIZ];
 
         dirfd = nmp_utils_sysctl_open_netdir(ifindex, ifname, ifname_verified);
@@ -1131,7 +1156,8 @@ _linktype_get_type(NMPlatform *      platform,
             if (faccessat(dirfd, "anycast_mask", F_OK, 0) == 0)
                 return NM_LINK_TYPE_OLPC_MESH;
 
-            devtype = _linktype_read_devtype(dirfd);
+            if (!udevice)
+                devtype = (devtype_free = _linktype_read_devtype(dirfd));
             if (devtype) {
                 link_type = _link_type_from_devtype(devtype);
                 if (link_type != NM_LINK_TYPE_NONE) {
@@ -1148,35 +1174,61 @@ _linktype_get_type(NMPlatform *      platform,
             if (nm_wifi_utils_is_wifi(dirfd, ifname_verified))
                 return NM_LINK_TYPE_WIFI;
         }
+    }
 
-        if (arptype == ARPHRD_ETHER) {
-            /* Misc non-upstream WWAN drivers.  rmnet is Qualcomm's proprietary
-             * modem interface, ccmni is MediaTek's.  FIXME: these drivers should
-             * really set devtype=WWAN.
-             */
-            if (g_str_has_prefix(ifname, "rmnet") || g_str_has_prefix(ifname, "rev_rmnet")
-                || g_str_has_prefix(ifname, "ccmni"))
-                return NM_LINK_TYPE_WWAN_NET;
-
-            /* Standard wired ethernet interfaces don't report an rtnl_link_type, so
-             * only allow fallback to Ethernet if no type is given.  This should
-             * prevent future virtual network drivers from being treated as Ethernet
-             * when they should be Generic instead.
-             */
-            if (!kind && !devtype)
-                return NM_LINK_TYPE_ETHERNET;
+    /* The driver name only matters for links that would otherwise end up
+     * as ethernet or unknown. Only ask ethtool for those. */
+    if (arptype == 256 || (!kind && !devtype)) {
+        NMPUtilsEthtoolDriverInfo driver_info;
+        const char *              driver = NULL;
+
+        if (udevice)
+            driver = udev_device_get_property_value(udevice, "ID_NET_DRIVER");
+        if (!driver && nmp_utils_ethtool_get_driver_info(ifindex, &driver_info))
+            driver = driver_info.driver;
 
-            /* The USB gadget interfaces behave and look like ordinary ethernet devices
-             * aside from the DEVTYPE. */
-            if (nm_streq0(devtype, "gadget"))
-                return NM_LINK_TYPE_ETHERNET;
+        if (driver) {
+            /* Fallback OVS detection for kernel <= 3.16 */
+            if (nm_streq(driver, "openvswitch"))
+                return NM_LINK_TYPE_OPENVSWITCH;
 
-            /* Distributed Switch Architecture switch chips */
-            if (nm_streq0(devtype, "dsa"))
-                return NM_LINK_TYPE_ETHERNET;
+            if (arptype == 256) {
+                /* Some s390 CTC-type devices report 256 for the encapsulation type
+                 * for some reason, but we need to call them Ethernet.
+                 */
+                if (nm_streq(driver, "ctcm"))
+                    return NM_LINK_TYPE_ETHERNET;
+            }
         }
     }
 
+    if (arptype == ARPHRD_ETHER) {
+        /* Misc non-upstream WWAN drivers.  rmnet is Qualcomm's proprietary
+         * modem interface, ccmni is MediaTek's.  FIXME: these drivers should
+         * really set devtype=WWAN.
+         */
+        if (g_str_has_prefix(ifname, "rmnet") || g_str_has_prefix(ifname, "rev_rmnet")
+            || g_str_has_prefix(ifname, "ccmni"))
+            return NM_LINK_TYPE_WWAN_NET;
+
+        /* Standard wired ethernet interfaces don't report an rtnl_link_type, so
+         * only allow fallback to Ethernet if no type is given.  This should
+         * prevent future virtual network drivers from being treated as Ethernet
+         * when they should be Generic instead.
+         */
+        if (!kind && !devtype)
+            return NM_LINK_TYPE_ETHERNET;
+
+        /* The USB gadget interfaces behave and look like ordinary ethernet devices
+         * aside from the DEVTYPE. */
+        if (nm_streq0(devtype, "gadget"))
+            return NM_LINK_TYPE_ETHERNET;
+
+        /* Distributed Switch Architecture switch chips */
+        if (nm_streq0(devtype, "dsa"))
+            return NM_LINK_TYPE_ETHERNET;
+    }
+
     return NM_LINK_TYPE_UNKNOWN;
 }
 
@@ -1296,6 +1348,116 @@ _parse_af_inet6(NMPlatform *        platform,
 
 /*****************************************************************************/
 
+static NMPObject *
+_parse_lnk_bond(const char *kind, struct nlattr *info_data)
+{
+    static const struct nla_policy policy[] = {
+        [IFLA_BOND_MODE]              = {.type = NLA_U8},
+        [IFLA_BOND_MIIMON]            = {.type = NLA_U32},
+        [IFLA_BOND_UPDELAY]           = {.type = NLA_U32},
+        [IFLA_BOND_DOWNDELAY]         = {.type = NLA_U32},
+        [IFLA_BOND_USE_CARRIER]       = {.type = NLA_U8},
+        [IFLA_BOND_ARP_INTERVAL]      = {.type = NLA_U32},
+        [IFLA_BOND_ARP_IP_TARGET]     = {.type = NLA_NESTED},
+        [IFLA_BOND_ARP_VALIDATE]      = {.type = NLA_U32},
+        [IFLA_BOND_ARP_ALL_TARGETS]   = {.type = NLA_U32},
+        [IFLA_BOND_PRIMARY]           = {.type = NLA_U32},
+        [IFLA_BOND_PRIMARY_RESELECT]  = {.type = NLA_U8},
+        [IFLA_BOND_FAIL_OVER_MAC]     = {.type = NLA_U8},
+        [IFLA_BOND_XMIT_HASH_POLICY]  = {.type = NLA_U8},
+        [IFLA_BOND_RESEND_IGMP]       = {.type = NLA_U32},
+        [IFLA_BOND_NUM_PEER_NOTIF]    = {.type = NLA_U8},
+        [IFLA_BOND_ALL_SLAVES_ACTIVE] = {.type = NLA_U8},
+        [IFLA_BOND_MIN_LINKS]         = {.type = NLA_U32},
+        [IFLA_BOND_LP_INTERVAL]       = {.type = NLA_U32},
+        [IFLA_BOND_PACKETS_PER_SLAVE] = {.type = NLA_U32},
+        [IFLA_BOND_AD_LACP_RATE]      = {.type = NLA_U8},
+        [IFLA_BOND_AD_SELECT]         = {.type = NLA_U8},
+        [IFLA_BOND_AD_ACTOR_SYS_PRIO] = {.type = NLA_U16},
+        [IFLA_BOND_AD_USER_PORT_KEY]  = {.type = NLA_U16},
+        [IFLA_BOND_AD_ACTOR_SYSTEM]   = {.minlen = sizeof(NMEtherAddr)},
+        [IFLA_BOND_TLB_DYNAMIC_LB]    = {.type = NLA_U8},
+    };
+    NMPlatformLnkBond *props;
+    struct nlattr *    tb[G_N_ELEMENTS(policy)];
+    NMPObject *        obj;
+
+    if (!info_data || !nm_streq0(kind, "bond"))
+        return NULL;
+
+    if (nla_parse_nested_arr(tb, info_data, policy) < 0)
+        return NULL;
+
+    obj = nmp_object_new(NMP_OBJECT_TYPE_LNK_BOND, NULL);
+
+    props = &obj->lnk_bond;
+
+    if (tb[IFLA_BOND_MODE])
+        props->mode = nla_get_u8(tb[IFLA_BOND_MODE]);
+    if (tb[IFLA_BOND_MIIMON])
+        props->miimon = nla_get_u32(tb[IFLA_BOND_MIIMON]);
+    if (tb[IFLA_BOND_UPDELAY])
+        props->updelay = nla_get_u32(tb[IFLA_BOND_UPDELAY]);
+    if (tb[IFLA_BOND_DOWNDELAY])
+        props->downdelay = nla_get_u32(tb[IFLA_BOND_DOWNDELAY]);
+    if (tb[IFLA_BOND_USE_CARRIER])
+        props->use_carrier = !!nla_get_u8(tb[IFLA_BOND_USE_CARRIER]);
+    if (tb[IFLA_BOND_ARP_INTERVAL])
+        props->arp_interval = nla_get_u32(tb[IFLA_BOND_ARP_INTERVAL]);
+    if (tb[IFLA_BOND_ARP_IP_TARGET]) {
+        struct nlattr *attr;
+        int            rem;
+
+        nla_for_each_nested (attr, tb[IFLA_BOND_ARP_IP_TARGET], rem) {
+            if (props->arp_ip_targets_num >= NM_BOND_MAX_ARP_TARGETS)
+                break;
+            if (nla_len(attr) < sizeof(in_addr_t))
+                continue;
+            props->arp_ip_target[props->arp_ip_targets_num++] = nla_get_u32(attr);
+        }
+    }
+    if (tb[IFLA_BOND_ARP_VALIDATE])
+        props->arp_validate = nla_get_u32(tb[IFLA_BOND_ARP_VALIDATE]);
+    if (tb[IFLA_BOND_ARP_ALL_TARGETS])
+        props->arp_all_targets = nla_get_u32(tb[IFLA_BOND_ARP_ALL_TARGETS]);
+    if (tb[IFLA_BOND_PRIMARY])
+        props->primary = (int) nla_get_u32(tb[IFLA_BOND_PRIMARY]);
+    if (tb[IFLA_BOND_PRIMARY_RESELECT])
+        props->primary_reselect = nla_get_u8(tb[IFLA_BOND_PRIMARY_RESELECT]);
+    if (tb[IFLA_BOND_FAIL_OVER_MAC])
+        props->fail_over_mac = nla_get_u8(tb[IFLA_BOND_FAIL_OVER_MAC]);
+    if (tb[IFLA_BOND_XMIT_HASH_POLICY])
+        props->xmit_hash_policy = nla_get_u8(tb[IFLA_BOND_XMIT_HASH_POLICY]);
+    if (tb[IFLA_BOND_RESEND_IGMP])
+        props->resend_igmp = nla_get_u32(tb[IFLA_BOND_RESEND_IGMP]);
+    if (tb[IFLA_BOND_NUM_PEER_NOTIF])
+        props->num_grat_arp = nla_get_u8(tb[IFLA_BOND_NUM_PEER_NOTIF]);
+    if (tb[IFLA_BOND_ALL_SLAVES_ACTIVE])
+        props->all_slaves_active = !!nla_get_u8(tb[IFLA_BOND_ALL_SLAVES_ACTIVE]);
+    if (tb[IFLA_BOND_MIN_LINKS])
+        props->min_links = nla_get_u32(tb[IFLA_BOND_MIN_LINKS]);
+    if (tb[IFLA_BOND_LP_INTERVAL])
+        props->lp_interval = nla_get_u32(tb[IFLA_BOND_LP_INTERVAL]);
+    if (tb[IFLA_BOND_PACKETS_PER_SLAVE])
+        props->packets_per_slave = nla_get_u32(tb[IFLA_BOND_PACKETS_PER_SLAVE]);
+    if (tb[IFLA_BOND_AD_LACP_RATE])
+        props->lacp_rate = nla_get_u8(tb[IFLA_BOND_AD_LACP_RATE]);
+    if (tb[IFLA_BOND_AD_SELECT])
+        props->ad_select = nla_get_u8(tb[IFLA_BOND_AD_SELECT]);
+    if (tb[IFLA_BOND_AD_ACTOR_SYS_PRIO])
+        props->ad_actor_sys_prio = nla_get_u16(tb[IFLA_BOND_AD_ACTOR_SYS_PRIO]);
+    if (tb[IFLA_BOND_AD_USER_PORT_KEY])
+        props->ad_user_port_key = nla_get_u16(tb[IFLA_BOND_AD_USER_PORT_KEY]);
+    if (tb[IFLA_BOND_AD_ACTOR_SYSTEM])
+        props->ad_actor_system = *nla_data_as(NMEtherAddr, tb[IFLA_BOND_AD_ACTOR_SYSTEM]);
+    if (tb[IFLA_BOND_TLB_DYNAMIC_LB])
+        props->tlb_dynamic_lb = !!nla_get_u8(tb[IFLA_BOND_TLB_DYNAMIC_LB]);
+
+    return obj;
+}
+
+/*****************************************************************************/
+
 static NMPObject *
 _parse_lnk_bridge(const char *kind, struct nlattr *info_data)
 {
@@ -2872,6 +3034,378 @@ link_wireguard_change(NMPlatform *                              platform,
 
 /*****************************************************************************/
 
+/* ethtool netlink interface (kernel 5.6+). Define what we need here, to not
+ * depend on recent kernel headers. */
+#define ETHTOOL_GENL_NAME    "ethtool"
+#define ETHTOOL_GENL_VERSION 1
+
+#define ETHTOOL_MSG_RINGS_GET    15
+#define ETHTOOL_MSG_RINGS_SET    16
+#define ETHTOOL_MSG_COALESCE_GET 19
+#define ETHTOOL_MSG_COALESCE_SET 20
+
+#define ETHTOOL_A_HEADER_DEV_INDEX 1
+
+#define ETHTOOL_A_RINGS_HEADER   1
+#define ETHTOOL_A_RINGS_RX       6
+#define ETHTOOL_A_RINGS_RX_MINI  7
+#define ETHTOOL_A_RINGS_RX_JUMBO 8
+#define ETHTOOL_A_RINGS_TX       9
+
+#define ETHTOOL_A_COALESCE_HEADER               1
+#define ETHTOOL_A_COALESCE_RX_USECS             2
+#define ETHTOOL_A_COALESCE_RX_MAX_FRAMES        3
+#define ETHTOOL_A_COALESCE_RX_USECS_IRQ         4
+#define ETHTOOL_A_COALESCE_RX_MAX_FRAMES_IRQ    5
+#define ETHTOOL_A_COALESCE_TX_USECS             6
+#define ETHTOOL_A_COALESCE_TX_MAX_FRAMES        7
+#define ETHTOOL_A_COALESCE_TX_USECS_IRQ         8
+#define ETHTOOL_A_COALESCE_TX_MAX_FRAMES_IRQ    9
+#define ETHTOOL_A_COALESCE_STATS_BLOCK_USECS    10
+#define ETHTOOL_A_COALESCE_USE_ADAPTIVE_RX      11
+#define ETHTOOL_A_COALESCE_USE_ADAPTIVE_TX      12
+#define ETHTOOL_A_COALESCE_PKT_RATE_LOW         13
+#define ETHTOOL_A_COALESCE_RX_USECS_LOW         14
+#define ETHTOOL_A_COALESCE_RX_MAX_FRAMES_LOW    15
+#define ETHTOOL_A_COALESCE_TX_USECS_LOW         16
+#define ETHTOOL_A_COALESCE_TX_MAX_FRAMES_LOW    17
+#define ETHTOOL_A_COALESCE_PKT_RATE_HIGH        18
+#define ETHTOOL_A_COALESCE_RX_USECS_HIGH        19
+#define ETHTOOL_A_COALESCE_RX_MAX_FRAMES_HIGH   20
+#define ETHTOOL_A_COALESCE_TX_USECS_HIGH        21
+#define ETHTOOL_A_COALESCE_TX_MAX_FRAMES_HIGH   22
+#define ETHTOOL_A_COALESCE_RATE_SAMPLE_INTERVAL 23
+
+static const guint8 _ethtool_coalesce_attrs[_NM_ETHTOOL_ID_COALESCE_NUM] = {
+#define _COALESCE_ATTR(id, attr) [_NM_ETHTOOL_ID_COALESCE_AS_IDX(NM_ETHTOOL_ID_COALESCE_##id)] = attr
+    _COALESCE_ATTR(ADAPTIVE_RX, ETHTOOL_A_COALESCE_USE_ADAPTIVE_RX),
+    _COALESCE_ATTR(ADAPTIVE_TX, ETHTOOL_A_COALESCE_USE_ADAPTIVE_TX),
+    _COALESCE_ATTR(PKT_RATE_HIGH, ETHTOOL_A_COALESCE_PKT_RATE_HIGH),
+    _COALESCE_ATTR(PKT_RATE_LOW, ETHTOOL_A_COALESCE_PKT_RATE_LOW),
+    _COALESCE_ATTR(RX_FRAMES, ETHTOOL_A_COALESCE_RX_MAX_FRAMES),
+    _COALESCE_ATTR(RX_FRAMES_HIGH, ETHTOOL_A_COALESCE_RX_MAX_FRAMES_HIGH),
+    _COALESCE_ATTR(RX_FRAMES_IRQ, ETHTOOL_A_COALESCE_RX_MAX_FRAMES_IRQ),
+    _COALESCE_ATTR(RX_FRAMES_LOW, ETHTOOL_A_COALESCE_RX_MAX_FRAMES_LOW),
+    _COALESCE_ATTR(RX_USECS, ETHTOOL_A_COALESCE_RX_USECS),
+    _COALESCE_ATTR(RX_USECS_HIGH, ETHTOOL_A_COALESCE_RX_USECS_HIGH),
+    _COALESCE_ATTR(RX_USECS_IRQ, ETHTOOL_A_COALESCE_RX_USECS_IRQ),
+    _COALESCE_ATTR(RX_USECS_LOW, ETHTOOL_A_COALESCE_RX_USECS_LOW),
+    _COALESCE_ATTR(SAMPLE_INTERVAL, ETHTOOL_A_COALESCE_RATE_SAMPLE_INTERVAL),
+    _COALESCE_ATTR(STATS_BLOCK_USECS, ETHTOOL_A_COALESCE_STATS_BLOCK_USECS),
+    _COALESCE_ATTR(TX_FRAMES, ETHTOOL_A_COALESCE_TX_MAX_FRAMES),
+    _COALESCE_ATTR(TX_FRAMES_HIGH, ETHTOOL_A_COALESCE_TX_MAX_FRAMES_HIGH),
+    _COALESCE_ATTR(TX_FRAMES_IRQ, ETHTOOL_A_COALESCE_TX_MAX_FRAMES_IRQ),
+    _COALESCE_ATTR(TX_FRAMES_LOW, ETHTOOL_A_COALESCE_TX_MAX_FRAMES_LOW),
+    _COALESCE_ATTR(TX_USECS, ETHTOOL_A_COALESCE_TX_USECS),
+    _COALESCE_ATTR(TX_USECS_HIGH, ETHTOOL_A_COALESCE_TX_USECS_HIGH),
+    _COALESCE_ATTR(TX_USECS_IRQ, ETHTOOL_A_COALESCE_TX_USECS_IRQ),
+    _COALESCE_ATTR(TX_USECS_LOW, ETHTOOL_A_COALESCE_TX_USECS_LOW),
+#undef _COALESCE_ATTR
+};
+
+static gboolean
+_ethtool_coalesce_attr_is_u8(guint8 attr)
+{
+    return NM_IN_SET(attr, ETHTOOL_A_COALESCE_USE_ADAPTIVE_RX, ETHTOOL_A_COALESCE_USE_ADAPTIVE_TX);
+}
+
+static int
+_ethtool_get_family_id(NMPlatform *platform)
+{
+    NMLinuxPlatformPrivate *priv = NM_LINUX_PLATFORM_GET_PRIVATE(platform);
+
+    if (priv->ethtool_family_id == 0) {
+        int family_id = -1;
+
+        if (priv->genl)
+            family_id = genl_ctrl_resolve(priv->genl, ETHTOOL_GENL_NAME);
+        if (family_id <= 0) {
+            _LOGD("ethtool: generic netlink family not available, use ioctl");
+            family_id = -1;
+        }
+        priv->ethtool_family_id = family_id;
+    }
+
+    return priv->ethtool_family_id;
+}
+
+static struct nl_msg *
+_ethtool_msg_new(int family_id, guint8 cmd, int header_attr, int ifindex)
+{
+    nm_auto_nlmsg struct nl_msg *msg = NULL;
+    struct nlattr *              header;
+
+    msg = nlmsg_alloc();
+
+    if (!genlmsg_put(msg, NL_AUTO_PORT, NL_AUTO_SEQ, family_id, 0, 0, cmd, ETHTOOL_GENL_VERSION))
+        goto nla_put_failure;
+
+    if (!(header = nla_nest_start(msg, header_attr)))
+        goto nla_put_failure;
+    NLA_PUT_U32(msg, ETHTOOL_A_HEADER_DEV_INDEX, (guint32) ifindex);
+    nla_nest_end(msg, header);
+
+    return g_steal_pointer(&msg);
+
+nla_put_failure:
+    g_return_val_if_reached(NULL);
+}
+
+/* Sends @msg on the generic netlink socket and waits for the reply.
+ * If @valid_cb is set, the request expects a reply message before the ACK.
+ *
+ * Kernel replies with EOPNOTSUPP if it does not know the command (the rings
+ * and coalesce messages only exist since 5.7) or if the driver does not
+ * implement it. That gets returned as -NME_PL_OPNOTSUPP, so that the caller
+ * falls back to ioctl. */
+static int
+_ethtool_request(NMPlatform *   platform,
+                 struct nl_msg *msg,
+                 int (*valid_cb)(struct nl_msg *, void *),
+                 gpointer valid_arg)
+{
+    NMLinuxPlatformPrivate *priv = NM_LINUX_PLATFORM_GET_PRIVATE(platform);
+    int                     r;
+
+    r = nl_send_auto(priv->genl, msg);
+    if (r < 0)
+        return r;
+
+    do {
+        r = nl_recvmsgs(priv->genl,
+                        valid_cb ? &((const struct nl_cb){
+                            .valid_cb  = valid_cb,
+                            .valid_arg = valid_arg,
+                        })
+                                 : NULL);
+    } while (r == -EAGAIN);
+
+    if (r >= 0 && valid_cb)
+        r = nl_wait_for_ack(priv->genl, NULL);
+
+    if (r < 0) {
+        if (r == -EOPNOTSUPP)
+            return -NME_PL_OPNOTSUPP;
+        return r;
+    }
+
+    return 0;
+}
+
+static int
+_ethtool_get_rings_cb(struct nl_msg *msg, void *arg)
+{
+    static const struct nla_policy policy[] = {
+        [ETHTOOL_A_RINGS_RX]       = {.type = NLA_U32},
+        [ETHTOOL_A_RINGS_RX_MINI]  = {.type = NLA_U32},
+        [ETHTOOL_A_RINGS_RX_JUMBO] = {.type = NLA_U32},
+        [ETHTOOL_A_RINGS_TX]       = {.type = NLA_U32},
+    };
+    NMEthtoolRingState *ring = arg;
+    struct nlattr *     tb[G_N_ELEMENTS(policy)];
+
+    if (genlmsg_parse_arr(nlmsg_hdr(msg), 0, tb, policy) < 0)
+        return NL_SKIP;
+
+    *ring = (NMEthtoolRingState){
+        .rx_pending       = tb[ETHTOOL_A_RINGS_RX] ? nla_get_u32(tb[ETHTOOL_A_RINGS_RX]) : 0u,
+        .rx_mini_pending  = tb[ETHTOOL_A_RINGS_RX_MINI] ? nla_get_u32(tb[ETHTOOL_A_RINGS_RX_MINI])
+                                                        : 0u,
+        .rx_jumbo_pending = tb[ETHTOOL_A_RINGS_RX_JUMBO] ? nla_get_u32(tb[ETHTOOL_A_RINGS_RX_JUMBO])
+                                                         : 0u,
+        .tx_pending       = tb[ETHTOOL_A_RINGS_TX] ? nla_get_u32(tb[ETHTOOL_A_RINGS_TX]) : 0u,
+    };
+    return NL_OK;
+}
+
+static int
+ethtool_get_ring(NMPlatform *platform, int ifindex, NMEthtoolRingState *ring)
+{
+    nm_auto_nlmsg struct nl_msg *msg = NULL;
+    int                          family_id;
+    int                          r;
+
+    family_id = _ethtool_get_family_id(platform);
+    if (family_id < 0)
+        return -NME_PL_OPNOTSUPP;
+
+    msg = _ethtool_msg_new(family_id, ETHTOOL_MSG_RINGS_GET, ETHTOOL_A_RINGS_HEADER, ifindex);
+    if (!msg)
+        return -NME_BUG;
+
+    r = _ethtool_request(platform, msg, _ethtool_get_rings_cb, ring);
+    if (r < 0) {
+        _LOGT("ethtool[%d]: get-ring: failure: %s", ifindex, nm_strerror(r));
+        return r;
+    }
+    return 0;
+}
+
+static int
+ethtool_set_ring(NMPlatform *platform, int ifindex, const NMEthtoolRingState *ring)
+{
+    nm_auto_nlmsg struct nl_msg *msg = NULL;
+    NMEthtoolRingState           ring_old;
+    int                          family_id;
+    int                          r;
+
+    /* Only send what changes. No request at all if nothing does. */
+    r = ethtool_get_ring(platform, ifindex, &ring_old);
+    if (r < 0)
+        return r;
+
+    if (memcmp(&ring_old, ring, sizeof(*ring)) == 0) {
+        _LOGT("ethtool[%d]: set-ring: ring settings unchanged", ifindex);
+        return 0;
+    }
+
+    family_id = _ethtool_get_family_id(platform);
+    msg       = _ethtool_msg_new(family_id, ETHTOOL_MSG_RINGS_SET, ETHTOOL_A_RINGS_HEADER, ifindex);
+    if (!msg)
+        return -NME_BUG;
+
+    if (ring->rx_pending != ring_old.rx_pending)
+        NLA_PUT_U32(msg, ETHTOOL_A_RINGS_RX, ring->rx_pending);
+    if (ring->rx_mini_pending != ring_old.rx_mini_pending)
+        NLA_PUT_U32(msg, ETHTOOL_A_RINGS_RX_MINI, ring->rx_mini_pending);
+    if (ring->rx_jumbo_pending != ring_old.rx_jumbo_pending)
+        NLA_PUT_U32(msg, ETHTOOL_A_RINGS_RX_JUMBO, ring->rx_jumbo_pending);
+    if (ring->tx_pending != ring_old.tx_pending)
+        NLA_PUT_U32(msg, ETHTOOL_A_RINGS_TX, ring->tx_pending);
+
+    r = _ethtool_request(platform, msg, NULL, NULL);
+    if (r < 0) {
+        _LOGT("ethtool[%d]: set-ring: failure: %s", ifindex, nm_strerror(r));
+        return r;
+    }
+    return 0;
+
+nla_put_failure:
+    g_return_val_if_reached(-NME_BUG);
+}
+
+static int
+_ethtool_get_coalesce_cb(struct nl_msg *msg, void *arg)
+{
+    static const struct nla_policy policy[] = {
+        [ETHTOOL_A_COALESCE_RX_USECS]             = {.type = NLA_U32},
+        [ETHTOOL_A_COALESCE_RX_MAX_FRAMES]        = {.type = NLA_U32},
+        [ETHTOOL_A_COALESCE_RX_USECS_IRQ]         = {.type = NLA_U32},
+        [ETHTOOL_A_COALESCE_RX_MAX_FRAMES_IRQ]    = {.type = NLA_U32},
+        [ETHTOOL_A_COALESCE_TX_USECS]             = {.type = NLA_U32},
+        [ETHTOOL_A_COALESCE_TX_MAX_FRAMES]        = {.type = NLA_U32},
+        [ETHTOOL_A_COALESCE_TX_USECS_IRQ]         = {.type = NLA_U32},
+        [ETHTOOL_A_COALESCE_TX_MAX_FRAMES_IRQ]    = {.type = NLA_U32},
+        [ETHTOOL_A_COALESCE_STATS_BLOCK_USECS]    = {.type = NLA_U32},
+        [ETHTOOL_A_COALESCE_USE_ADAPTIVE_RX]      = {.type = NLA_U8},
+        [ETHTOOL_A_COALESCE_USE_ADAPTIVE_TX]      = {.type = NLA_U8},
+        [ETHTOOL_A_COALESCE_PKT_RATE_LOW]         = {.type = NLA_U32},
+        [ETHTOOL_A_COALESCE_RX_USECS_LOW]         = {.type = NLA_U32},
+        [ETHTOOL_A_COALESCE_RX_MAX_FRAMES_LOW]    = {.type = NLA_U32},
+        [ETHTOOL_A_COALESCE_TX_USECS_LOW]         = {.type = NLA_U32},
+        [ETHTOOL_A_COALESCE_TX_MAX_FRAMES_LOW]    = {.type = NLA_U32},
+        [ETHTOOL_A_COALESCE_PKT_RATE_HIGH]        = {.type = NLA_U32},
+        [ETHTOOL_A_COALESCE_RX_USECS_HIGH]        = {.type = NLA_U32},
+        [ETHTOOL_A_COALESCE_RX_MAX_FRAMES_HIGH]   = {.type = NLA_U32},
+        [ETHTOOL_A_COALESCE_TX_USECS_HIGH]        = {.type = NLA_U32},
+        [ETHTOOL_A_COALESCE_TX_MAX_FRAMES_HIGH]   = {.type = NLA_U32},
+        [ETHTOOL_A_COALESCE_RATE_SAMPLE_INTERVAL] = {.type = NLA_U32},
+    };
+    NMEthtoolCoalesceState *coalesce = arg;
+    struct nlattr *         tb[G_N_ELEMENTS(policy)];
+    guint                   i;
+
+    if (genlmsg_parse_arr(nlmsg_hdr(msg), 0, tb, policy) < 0)
+        return NL_SKIP;
+
+    for (i = 0; i < _NM_ETHTOOL_ID_COALESCE_NUM; i++) {
+        guint8 attr = _ethtool_coalesce_attrs[i];
+
+        if (!tb[attr])
+            coalesce->s[i] = 0;
+        else if (_ethtool_coalesce_attr_is_u8(attr))
+            coalesce->s[i] = nla_get_u8(tb[attr]);
+        else
+            coalesce->s[i] = nla_get_u32(tb[attr]);
+    }
+    return NL_OK;
+}
+
+static int
+ethtool_get_coalesce(NMPlatform *platform, int ifindex, NMEthtoolCoalesceState *coalesce)
+{
+    nm_auto_nlmsg struct nl_msg *msg = NULL;
+    int                          family_id;
+    int                          r;
+
+    family_id = _ethtool_get_family_id(platform);
+    if (family_id < 0)
+        return -NME_PL_OPNOTSUPP;
+
+    msg = _ethtool_msg_new(family_id, ETHTOOL_MSG_COALESCE_GET, ETHTOOL_A_COALESCE_HEADER, ifindex);
+    if (!msg)
+        return -NME_BUG;
+
+    r = _ethtool_request(platform, msg, _ethtool_get_coalesce_cb, coalesce);
+    if (r < 0) {
+        _LOGT("ethtool[%d]: get-coalesce: failure: %s", ifindex, nm_strerror(r));
+        return r;
+    }
+    return 0;
+}
+
+static int
+ethtool_set_coalesce(NMPlatform *platform, int ifindex, const NMEthtoolCoalesceState *coalesce)
+{
+    nm_auto_nlmsg struct nl_msg *msg = NULL;
+    NMEthtoolCoalesceState       coalesce_old;
+    int                          family_id;
+    guint                        i;
+    int                          r;
+
+    /* Kernel rejects attributes for parameters that the driver does not
+     * support, even if the value does not change. Only send what changes. */
+    r = ethtool_get_coalesce(platform, ifindex, &coalesce_old);
+    if (r < 0)
+        return r;
+
+    if (memcmp(&coalesce_old, coalesce, sizeof(*coalesce)) == 0) {
+        _LOGT("ethtool[%d]: set-coalesce: coalesce settings unchanged", ifindex);
+        return 0;
+    }
+
+    family_id = _ethtool_get_family_id(platform);
+    msg       = _ethtool_msg_new(family_id,
+                                 ETHTOOL_MSG_COALESCE_SET,
+                                 ETHTOOL_A_COALESCE_HEADER,
+                                 ifindex);
+    if (!msg)
+        return -NME_BUG;
+
+    for (i = 0; i < _NM_ETHTOOL_ID_COALESCE_NUM; i++) {
+        guint8 attr = _ethtool_coalesce_attrs[i];
+
+        if (coalesce->s[i] == coalesce_old.s[i])
+            continue;
+        if (_ethtool_coalesce_attr_is_u8(attr))
+            NLA_PUT_U8(msg, attr, !!coalesce->s[i]);
+        else
+            NLA_PUT_U32(msg, attr, coalesce->s[i]);
+    }
+
+    r = _ethtool_request(platform, msg, NULL, NULL);
+    if (r < 0) {
+        _LOGT("ethtool[%d]: set-coalesce: failure: %s", ifindex, nm_strerror(r));
+        return r;
+    }
+    return 0;
+
+nla_put_failure:
+    g_return_val_if_reached(-NME_BUG);
+}
+
+/*****************************************************************************/
+
 static void
 _nmp_link_address_set(NMPLinkAddress *dst, const struct nlattr *nla)
 {
@@ -3064,6 +3598,9 @@ _new_from_nl_link(NMPlatform *     platform,
     }
 
     switch (obj->link.type) {
+    case NM_LINK_TYPE_BOND:
+        lnk_data = _parse_lnk_bond(nl_info_kind, nl_info_data);
+        break;
     case NM_LINK_TYPE_BRIDGE:
         lnk_data = _parse_lnk_bridge(nl_info_kind, nl_info_data);
         break;
@@ -4086,6 +4623,162 @@ nla_put_failure:
     g_return_val_if_reached(FALSE);
 }
 
+/* Appends the IFLA_BR_* attributes of @props. If @props_old is given,
+ * only the attributes that differ from it are appended. */
+static gboolean
+_nl_msg_new_link_put_lnk_bridge(struct nl_msg *            msg,
+                                const NMPlatformLnkBridge *props,
+                                const NMPlatformLnkBridge *props_old)
+{
+#define _CHANGED(field) (!props_old || props->field != props_old->field)
+
+    if (_CHANGED(forward_delay))
+        NLA_PUT_U32(msg, IFLA_BR_FORWARD_DELAY, props->forward_delay);
+    if (_CHANGED(hello_time))
+        NLA_PUT_U32(msg, IFLA_BR_HELLO_TIME, props->hello_time);
+    if (_CHANGED(max_age))
+        NLA_PUT_U32(msg, IFLA_BR_MAX_AGE, props->max_age);
+    if (_CHANGED(ageing_time))
+        NLA_PUT_U32(msg, IFLA_BR_AGEING_TIME, props->ageing_time);
+    if (_CHANGED(stp_state))
+        NLA_PUT_U32(msg, IFLA_BR_STP_STATE, !!props->stp_state);
+    if (_CHANGED(priority))
+        NLA_PUT_U16(msg, IFLA_BR_PRIORITY, props->priority);
+    if (_CHANGED(vlan_protocol))
+        NLA_PUT_U16(msg, IFLA_BR_VLAN_PROTOCOL, htons(props->vlan_protocol));
+    if (props_old ? (props->vlan_stats_enabled != props_old->vlan_stats_enabled)
+                  : props->vlan_stats_enabled)
+        NLA_PUT_U8(msg, IFLA_BR_VLAN_STATS_ENABLED, !!props->vlan_stats_enabled);
+    if (_CHANGED(group_fwd_mask))
+        NLA_PUT_U16(msg, IFLA_BR_GROUP_FWD_MASK, props->group_fwd_mask);
+    if (!props_old || !nm_ether_addr_equal(&props->group_addr, &props_old->group_addr))
+        NLA_PUT(msg, IFLA_BR_GROUP_ADDR, sizeof(props->group_addr), &props->group_addr);
+    if (_CHANGED(mcast_snooping))
+        NLA_PUT_U8(msg, IFLA_BR_MCAST_SNOOPING, !!props->mcast_snooping);
+    if (_CHANGED(mcast_router))
+        NLA_PUT_U8(msg, IFLA_BR_MCAST_ROUTER, props->mcast_router);
+    if (_CHANGED(mcast_query_use_ifaddr))
+        NLA_PUT_U8(msg, IFLA_BR_MCAST_QUERY_USE_IFADDR, !!props->mcast_query_use_ifaddr);
+    if (_CHANGED(mcast_querier))
+        NLA_PUT_U8(msg, IFLA_BR_MCAST_QUERIER, !!props->mcast_querier);
+    if (_CHANGED(mcast_hash_max))
+        NLA_PUT_U32(msg, IFLA_BR_MCAST_HASH_MAX, props->mcast_hash_max);
+    if (_CHANGED(mcast_last_member_count))
+        NLA_PUT_U32(msg, IFLA_BR_MCAST_LAST_MEMBER_CNT, props->mcast_last_member_count);
+    if (_CHANGED(mcast_startup_query_count))
+        NLA_PUT_U32(msg, IFLA_BR_MCAST_STARTUP_QUERY_CNT, props->mcast_startup_query_count);
+    if (_CHANGED(mcast_last_member_interval))
+        NLA_PUT_U64(msg, IFLA_BR_MCAST_LAST_MEMBER_INTVL, props->mcast_last_member_interval);
+    if (_CHANGED(mcast_membership_interval))
+        NLA_PUT_U64(msg, IFLA_BR_MCAST_MEMBERSHIP_INTVL, props->mcast_membership_interval);
+    if (_CHANGED(mcast_querier_interval))
+        NLA_PUT_U64(msg, IFLA_BR_MCAST_QUERIER_INTVL, props->mcast_querier_interval);
+    if (_CHANGED(mcast_query_interval))
+        NLA_PUT_U64(msg, IFLA_BR_MCAST_QUERY_INTVL, props->mcast_query_interval);
+    if (_CHANGED(mcast_query_response_interval))
+        NLA_PUT_U64(msg,
+                    IFLA_BR_MCAST_QUERY_RESPONSE_INTVL,
+                    props->mcast_query_response_interval);
+    if (_CHANGED(mcast_startup_query_interval))
+        NLA_PUT_U64(msg, IFLA_BR_MCAST_STARTUP_QUERY_INTVL, props->mcast_startup_query_interval);
+
+#undef _CHANGED
+
+    return TRUE;
+nla_put_failure:
+    return FALSE;
+}
+
+/* Appends the IFLA_BOND_* attributes of @props that differ from @props_old.
+ *
+ * Note that kernel processes the attributes in a fixed order (the mode
+ * first) and rejects options that are not supported by the current mode,
+ * even if their value does not change. Hence, only send what changed. */
+static gboolean
+_nl_msg_new_link_put_lnk_bond(struct nl_msg *          msg,
+                              const NMPlatformLnkBond *props,
+                              const NMPlatformLnkBond *props_old)
+{
+    static const NMPlatformLnkBond props_empty = {};
+    struct nlattr *                targets;
+    guint                          i;
+
+    if (!props_old)
+        props_old = &props_empty;
+
+#define _CHANGED(field) (props->field != props_old->field)
+
+    if (_CHANGED(mode))
+        NLA_PUT_U8(msg, IFLA_BOND_MODE, props->mode);
+    if (_CHANGED(miimon))
+        NLA_PUT_U32(msg, IFLA_BOND_MIIMON, props->miimon);
+    if (_CHANGED(updelay))
+        NLA_PUT_U32(msg, IFLA_BOND_UPDELAY, props->updelay);
+    if (_CHANGED(downdelay))
+        NLA_PUT_U32(msg, IFLA_BOND_DOWNDELAY, props->downdelay);
+    if (_CHANGED(use_carrier))
+        NLA_PUT_U8(msg, IFLA_BOND_USE_CARRIER, !!props->use_carrier);
+    if (_CHANGED(arp_interval))
+        NLA_PUT_U32(msg, IFLA_BOND_ARP_INTERVAL, props->arp_interval);
+    if (_CHANGED(arp_ip_targets_num)
+        || memcmp(props->arp_ip_target,
+                  props_old->arp_ip_target,
+                  props->arp_ip_targets_num * sizeof(props->arp_ip_target[0]))
+               != 0) {
+        /* kernel replaces the entire list. */
+        if (!(targets = nla_nest_start(msg, IFLA_BOND_ARP_IP_TARGET)))
+            goto nla_put_failure;
+        for (i = 0; i < props->arp_ip_targets_num; i++)
+            NLA_PUT_U32(msg, i, props->arp_ip_target[i]);
+        nla_nest_end(msg, targets);
+    }
+    if (_CHANGED(arp_validate))
+        NLA_PUT_U32(msg, IFLA_BOND_ARP_VALIDATE, props->arp_validate);
+    if (_CHANGED(arp_all_targets))
+        NLA_PUT_U32(msg, IFLA_BOND_ARP_ALL_TARGETS, props->arp_all_targets);
+    if (_CHANGED(primary))
+        NLA_PUT_U32(msg, IFLA_BOND_PRIMARY, props->primary);
+    if (_CHANGED(primary_reselect))
+        NLA_PUT_U8(msg, IFLA_BOND_PRIMARY_RESELECT, props->primary_reselect);
+    if (_CHANGED(fail_over_mac))
+        NLA_PUT_U8(msg, IFLA_BOND_FAIL_OVER_MAC, props->fail_over_mac);
+    if (_CHANGED(xmit_hash_policy))
+        NLA_PUT_U8(msg, IFLA_BOND_XMIT_HASH_POLICY, props->xmit_hash_policy);
+    if (_CHANGED(resend_igmp))
+        NLA_PUT_U32(msg, IFLA_BOND_RESEND_IGMP, props->resend_igmp);
+    if (_CHANGED(num_grat_arp))
+        NLA_PUT_U8(msg, IFLA_BOND_NUM_PEER_NOTIF, props->num_grat_arp);
+    if (_CHANGED(all_slaves_active))
+        NLA_PUT_U8(msg, IFLA_BOND_ALL_SLAVES_ACTIVE, !!props->all_slaves_active);
+    if (_CHANGED(min_links))
+        NLA_PUT_U32(msg, IFLA_BOND_MIN_LINKS, props->min_links);
+    if (_CHANGED(lp_interval))
+        NLA_PUT_U32(msg, IFLA_BOND_LP_INTERVAL, props->lp_interval);
+    if (_CHANGED(packets_per_slave))
+        NLA_PUT_U32(msg, IFLA_BOND_PACKETS_PER_SLAVE, props->packets_per_slave);
+    if (_CHANGED(lacp_rate))
+        NLA_PUT_U8(msg, IFLA_BOND_AD_LACP_RATE, props->lacp_rate);
+    if (_CHANGED(ad_select))
+        NLA_PUT_U8(msg, IFLA_BOND_AD_SELECT, props->ad_select);
+    if (_CHANGED(ad_actor_sys_prio))
+        NLA_PUT_U16(msg, IFLA_BOND_AD_ACTOR_SYS_PRIO, props->ad_actor_sys_prio);
+    if (_CHANGED(ad_user_port_key))
+        NLA_PUT_U16(msg, IFLA_BOND_AD_USER_PORT_KEY, props->ad_user_port_key);
+    if (!nm_ether_addr_equal(&props->ad_actor_system, &props_old->ad_actor_system))
+        NLA_PUT(msg,
+                IFLA_BOND_AD_ACTOR_SYSTEM,
+                sizeof(props->ad_actor_system),
+                &props->ad_actor_system);
+    if (_CHANGED(tlb_dynamic_lb))
+        NLA_PUT_U8(msg, IFLA_BOND_TLB_DYNAMIC_LB, !!props->tlb_dynamic_lb);
+
+#undef _CHANGED
+
+    return TRUE;
+nla_put_failure:
+    return FALSE;
+}
+
 static gboolean
 _nl_msg_new_link_set_linkinfo(struct nl_msg *msg, NMLinkType link_type, gconstpointer extra_data)
 {
@@ -4114,30 +4807,8 @@ _nl_msg_new_link_set_linkinfo(struct nl_msg *msg, NMLinkType link_type, gconstpo
         if (!(data = nla_nest_start(msg, IFLA_INFO_DATA)))
             goto nla_put_failure;
 
-        NLA_PUT_U32(msg, IFLA_BR_FORWARD_DELAY, props->forward_delay);
-        NLA_PUT_U32(msg, IFLA_BR_HELLO_TIME, props->hello_time);
-        NLA_PUT_U32(msg, IFLA_BR_MAX_AGE, props->max_age);
-        NLA_PUT_U32(msg, IFLA_BR_AGEING_TIME, props->ageing_time);
-        NLA_PUT_U32(msg, IFLA_BR_STP_STATE, !!props->stp_state);
-        NLA_PUT_U16(msg, IFLA_BR_PRIORITY, props->priority);
-        NLA_PUT_U16(msg, IFLA_BR_VLAN_PROTOCOL, htons(props->vlan_protocol));
-        if (props->vlan_stats_enabled)
-            NLA_PUT_U8(msg, IFLA_BR_VLAN_STATS_ENABLED, !!props->vlan_stats_enabled);
-        NLA_PUT_U16(msg, IFLA_BR_GROUP_FWD_MASK, props->group_fwd_mask);
-        NLA_PUT(msg, IFLA_BR_GROUP_ADDR, sizeof(props->group_addr), &props->group_addr);
-        NLA_PUT_U8(msg, IFLA_BR_MCAST_SNOOPING, !!props->mcast_snooping);
-        NLA_PUT_U8(msg, IFLA_BR_MCAST_ROUTER, props->mcast_router);
-        NLA_PUT_U8(msg, IFLA_BR_MCAST_QUERY_USE_IFADDR, !!props->mcast_query_use_ifaddr);
-        NLA_PUT_U8(msg, IFLA_BR_MCAST_QUERIER, !!props->mcast_querier);
-        NLA_PUT_U32(msg, IFLA_BR_MCAST_HASH_MAX, props->mcast_hash_max);
-        NLA_PUT_U32(msg, IFLA_BR_MCAST_LAST_MEMBER_CNT, props->mcast_last_member_count);
-        NLA_PUT_U32(msg, IFLA_BR_MCAST_STARTUP_QUERY_CNT, props->mcast_startup_query_count);
-        NLA_PUT_U64(msg, IFLA_BR_MCAST_LAST_MEMBER_INTVL, props->mcast_last_member_interval);
-        NLA_PUT_U64(msg, IFLA_BR_MCAST_MEMBERSHIP_INTVL, props->mcast_membership_interval);
-        NLA_PUT_U64(msg, IFLA_BR_MCAST_QUERIER_INTVL, props->mcast_querier_interval);
-        NLA_PUT_U64(msg, IFLA_BR_MCAST_QUERY_INTVL, props->mcast_query_interval);
-        NLA_PUT_U64(msg, IFLA_BR_MCAST_QUERY_RESPONSE_INTVL, props->mcast_query_response_interval);
-        NLA_PUT_U64(msg, IFLA_BR_MCAST_STARTUP_QUERY_INTVL, props->mcast_startup_query_interval);
+        if (!_nl_msg_new_link_put_lnk_bridge(msg, props, NULL))
+            goto nla_put_failure;
         break;
     }
     case NM_LINK_TYPE_VLAN:
@@ -5378,6 +6049,17 @@ sysctl_async_thread_fn(GTask *       task,
     g_task_return_boolean(task, TRUE);
 }
 
+static void
+sysctl_async_pool_fn(gpointer data, gpointer user_data)
+{
+    gs_unref_object GTask *task = data;
+
+    sysctl_async_thread_fn(task,
+                           g_task_get_source_object(task),
+                           g_task_get_task_data(task),
+                           g_task_get_cancellable(task));
+}
+
 static void
 sysctl_set_async_return_idle(gpointer user_data, GCancellable *cancellable)
 {
@@ -5402,11 +6084,12 @@ sysctl_set_async(NMPlatform *            platform,
                  gpointer                data,
                  GCancellable *          cancellable)
 {
-    SysctlAsyncInfo *info;
-    GTask *          task;
-    int              dirfd_dup, errsv;
-    gpointer         packed;
-    GError *         error = NULL;
+    NMLinuxPlatformPrivate *priv = NM_LINUX_PLATFORM_GET_PRIVATE(platform);
+    SysctlAsyncInfo *       info;
+    GTask *                 task;
+    int                     dirfd_dup, errsv;
+    gpointer                packed;
+    GError *                error = NULL;
 
     g_return_if_fail(platform);
     g_return_if_fail(path);
@@ -5447,8 +6130,13 @@ sysctl_set_async(NMPlatform *            platform,
     task = g_task_new(platform, cancellable, sysctl_async_cb, NULL);
     g_task_set_task_data(task, info, (GDestroyNotify) sysctl_async_info_free);
     g_task_set_return_on_cancel(task, FALSE);
-    g_task_run_in_thread(task, sysctl_async_thread_fn);
-    g_object_unref(task);
+
+    /* Instead of g_task_run_in_thread(), queue the requests to our own pool
+     * with only one thread. The writes don't need parallelism, and this
+     * way they also happen in the order they were requested. */
+    if (!priv->sysctl_async_pool)
+        priv->sysctl_async_pool = g_thread_pool_new(sysctl_async_pool_fn, NULL, 1, FALSE, NULL);
+    g_thread_pool_push(priv->sysctl_async_pool, task, NULL);
 }
 
 static GSList *sysctl_clear_cache_list;
@@ -5605,6 +6293,33 @@ process_events(NMPlatform *platform)
 
 /*****************************************************************************/
 
+static void
+_stats_histogram_add(NMPlatformStatsHistogram *hist, gint64 duration_ns)
+{
+    guint64 usec = duration_ns > 0 ? ((guint64) duration_ns) / 1000u : 0u;
+    guint64 limit;
+    guint   i;
+
+    hist->count++;
+    hist->sum_usec += usec;
+    if (usec > hist->max_usec)
+        hist->max_usec = usec;
+
+    for (i = 0, limit = 10; i < G_N_ELEMENTS(hist->buckets) - 1; i++, limit *= 10) {
+        if (usec < limit)
+            break;
+    }
+    hist->buckets[i]++;
+}
+
+static const NMPlatformStats *
+get_stats(NMPlatform *platform)
+{
+    return &NM_LINUX_PLATFORM_GET_PRIVATE(platform)->stats;
+}
+
+/*****************************************************************************/
+
 static const RefreshAllInfo *
 refresh_all_type_get_info(RefreshAllType refresh_all_type)
 {
@@ -5852,6 +6567,9 @@ delayed_action_wait_for_nl_response_complete(NMPlatform *            platform,
 
     _LOGt_delayed_action(DELAYED_ACTION_TYPE_WAIT_FOR_NL_RESPONSE, data, "complete");
 
+    _stats_histogram_add(&priv->stats.ack_wait,
+                         nm_utils_get_monotonic_timestamp_nsec() - data->start_ns);
+
     if (priv->delayed_action.list_wait_for_nl_response->len <= 1)
         priv->delayed_action.flags &= ~DELAYED_ACTION_TYPE_WAIT_FOR_NL_RESPONSE;
     if (data->out_seq_result)
@@ -5872,6 +6590,9 @@ delayed_action_wait_for_nl_response_complete(NMPlatform *            platform,
             data->response.out_route_get = NULL;
         }
         break;
+    case DELAYED_ACTION_RESPONSE_TYPE_BRIDGE_VLANS_GET:
+        data->response.out_bridge_vlans_get = NULL;
+        break;
     }
 
     g_array_remove_index_fast(priv->delayed_action.list_wait_for_nl_response, idx);
@@ -6136,10 +6857,11 @@ delayed_action_schedule_WAIT_FOR_NL_RESPONSE(NMPlatform *
                                              DelayedActionWaitForNlResponseType response_type,
                                              gpointer                           response_out_data)
 {
-    DelayedActionWaitForNlResponseData data = {
-        .seq_number = seq_number,
-        .timeout_abs_ns =
-            nm_utils_get_monotonic_timestamp_nsec() + (200 * (NM_UTILS_NSEC_PER_SEC / 1000)),
+    gint64                             now_ns = nm_utils_get_monotonic_timestamp_nsec();
+    DelayedActionWaitForNlResponseData data   = {
+        .seq_number        = seq_number,
+        .start_ns          = now_ns,
+        .timeout_abs_ns    = now_ns + (200 * (NM_UTILS_NSEC_PER_SEC / 1000)),
         .out_seq_result    = out_seq_result,
         .out_errmsg        = out_errmsg,
         .response_type     = response_type,
@@ -6211,10 +6933,11 @@ cache_on_change(NMPlatform *     platform,
                 const NMPObject *obj_old,
                 const NMPObject *obj_new)
 {
-    const NMPClass *klass;
-    char            str_buf[sizeof(_nm_utils_to_string_buffer)];
-    char            str_buf2[sizeof(_nm_utils_to_string_buffer)];
-    NMPCache *      cache = nm_platform_get_cache(platform);
+    NMLinuxPlatformPrivate *priv = NM_LINUX_PLATFORM_GET_PRIVATE(platform);
+    const NMPClass *        klass;
+    char                    str_buf[sizeof(_nm_utils_to_string_buffer)];
+    char                    str_buf2[sizeof(_nm_utils_to_string_buffer)];
+    NMPCache *              cache = nm_platform_get_cache(platform);
 
     ASSERT_nmp_cache_ops(cache, cache_op, obj_old, obj_new);
     nm_assert(cache_op != NMP_CACHE_OPS_UNCHANGED);
@@ -6239,6 +6962,10 @@ cache_on_change(NMPlatform *     platform,
     switch (klass->obj_type) {
     case NMP_OBJECT_TYPE_LINK:
     {
+        if (cache_op == NMP_CACHE_OPS_REMOVED && priv->stats.msgs_by_ifindex)
+            g_hash_table_remove(priv->stats.msgs_by_ifindex,
+                                GINT_TO_POINTER(obj_old->link.ifindex));
+
         /* check whether changing a slave link can cause a master link (bridge or bond) to go up/down */
         if (obj_old
             && nmp_cache_link_connected_needs_toggle_by_ifindex(cache,
@@ -6683,6 +7410,8 @@ do_request_all_no_delayed_actions(NMPlatform *platform, DelayedActionType action
     nm_assert(!NM_FLAGS_ANY(action_type, ~DELAYED_ACTION_TYPE_REFRESH_ALL));
     action_type &= DELAYED_ACTION_TYPE_REFRESH_ALL;
 
+    priv->stats.resyncs++;
+
     action_type_prune = action_type;
 
     /* calling nmp_cache_dirty_set_all_main() with a non-main lookup-index requires an extra
@@ -6844,6 +7573,79 @@ event_seq_check(NMPlatform *            platform,
 #endif
 }
 
+/* Kernel answers a RTM_GETLINK dump for AF_BRIDGE with one RTM_NEWLINK
+ * message per bridge and bridge port. These messages are not tracked by
+ * the cache. Collect the VLANs for the ifindex that a pending
+ * link_get_bridge_vlans() request asks for. */
+static void
+_bridge_vlans_get_handle_msg(NMPlatform *platform, struct nlmsghdr *msghdr)
+{
+    static const struct nla_policy policy[] = {
+        [IFLA_AF_SPEC] = {.type = NLA_NESTED},
+    };
+    NMLinuxPlatformPrivate * priv     = NM_LINUX_PLATFORM_GET_PRIVATE(platform);
+    BridgeVlansGetData *     get_data = NULL;
+    const struct ifinfomsg * ifi;
+    struct nlattr *          tb[G_N_ELEMENTS(policy)];
+    struct nlattr *          attr;
+    int                      remaining;
+    guint16                  range_start = 0;
+    gboolean                 in_range    = FALSE;
+    guint                    i;
+
+    if (!NM_FLAGS_HAS(priv->delayed_action.flags, DELAYED_ACTION_TYPE_WAIT_FOR_NL_RESPONSE))
+        return;
+
+    for (i = 0; i < priv->delayed_action.list_wait_for_nl_response->len; i++) {
+        DelayedActionWaitForNlResponseData *data =
+            &g_array_index(priv->delayed_action.list_wait_for_nl_response,
+                           DelayedActionWaitForNlResponseData,
+                           i);
+
+        if (data->response_type == DELAYED_ACTION_RESPONSE_TYPE_BRIDGE_VLANS_GET
+            && data->response.out_bridge_vlans_get && data->seq_number == msghdr->nlmsg_seq) {
+            get_data = data->response.out_bridge_vlans_get;
+            break;
+        }
+    }
+    if (!get_data)
+        return;
+
+    ifi = nlmsg_data(msghdr);
+    if (ifi->ifi_index != get_data->ifindex)
+        return;
+
+    if (nlmsg_parse_arr(msghdr, sizeof(*ifi), tb, policy) < 0)
+        return;
+    if (!tb[IFLA_AF_SPEC])
+        return;
+
+    nla_for_each_nested (attr, tb[IFLA_AF_SPEC], remaining) {
+        const struct bridge_vlan_info *vinfo;
+        NMPlatformBridgeVlan           vlan;
+
+        if (nla_type(attr) != IFLA_BRIDGE_VLAN_INFO || nla_len(attr) < sizeof(*vinfo))
+            continue;
+
+        vinfo = nla_data(attr);
+        if (vinfo->flags & BRIDGE_VLAN_INFO_RANGE_BEGIN) {
+            range_start = vinfo->vid;
+            in_range    = TRUE;
+            continue;
+        }
+
+        vlan = (NMPlatformBridgeVlan){
+            .vid_start = (in_range && (vinfo->flags & BRIDGE_VLAN_INFO_RANGE_END)) ? range_start
+                                                                                  : vinfo->vid,
+            .vid_end   = vinfo->vid,
+            .untagged  = NM_FLAGS_HAS(vinfo->flags, BRIDGE_VLAN_INFO_UNTAGGED),
+            .pvid      = NM_FLAGS_HAS(vinfo->flags, BRIDGE_VLAN_INFO_PVID),
+        };
+        in_range = FALSE;
+        g_array_append_val(get_data->vlans, vlan);
+    }
+}
+
 static void
 event_valid_msg(NMPlatform *platform, struct nl_msg *msg, gboolean handle_events)
 {
@@ -6855,6 +7657,7 @@ event_valid_msg(NMPlatform *platform, struct nl_msg *msg, gboolean handle_events
     gboolean                  is_del  = FALSE;
     gboolean                  is_dump = FALSE;
     NMPCache *                cache   = nm_platform_get_cache(platform);
+    gint64                    start_ns;
 
     msghdr = nlmsg_hdr(msg);
 
@@ -6882,6 +7685,13 @@ event_valid_msg(NMPlatform *platform, struct nl_msg *msg, gboolean handle_events
     if (!handle_events)
         return;
 
+    priv = NM_LINUX_PLATFORM_GET_PRIVATE(platform);
+
+    if (msghdr->nlmsg_type < G_N_ELEMENTS(priv->stats.msgs_by_type))
+        priv->stats.msgs_by_type[msghdr->nlmsg_type]++;
+    else
+        priv->stats.msgs_other++;
+
     if (NM_IN_SET(msghdr->nlmsg_type,
                   RTM_DELLINK,
                   RTM_DELADDR,
@@ -6894,13 +7704,32 @@ event_valid_msg(NMPlatform *platform, struct nl_msg *msg, gboolean handle_events
         is_del = TRUE;
     }
 
-    obj = nmp_object_new_from_nl(platform, cache, msg, is_del);
+    if (msghdr->nlmsg_type == RTM_NEWLINK && nlmsg_valid_hdr(msghdr, sizeof(struct ifinfomsg))
+        && ((const struct ifinfomsg *) nlmsg_data(msghdr))->ifi_family == AF_BRIDGE) {
+        _bridge_vlans_get_handle_msg(platform, msghdr);
+        return;
+    }
+
+    start_ns = nm_utils_get_monotonic_timestamp_nsec();
+    obj      = nmp_object_new_from_nl(platform, cache, msg, is_del);
+    _stats_histogram_add(&priv->stats.parse, nm_utils_get_monotonic_timestamp_nsec() - start_ns);
     if (!obj) {
         _LOGT("event-notification: %s: ignore",
               nl_nlmsghdr_to_str(msghdr, buf_nlmsghdr, sizeof(buf_nlmsghdr)));
         return;
     }
 
+    if (_NMP_OBJECT_TYPE_IS_OBJ_WITH_IFINDEX(NMP_OBJECT_GET_TYPE(obj))
+        && NMP_OBJECT_CAST_OBJ_WITH_IFINDEX(obj)->ifindex > 0) {
+        gpointer ifindex_key = GINT_TO_POINTER(NMP_OBJECT_CAST_OBJ_WITH_IFINDEX(obj)->ifindex);
+        gsize    count;
+
+        if (!priv->stats.msgs_by_ifindex)
+            priv->stats.msgs_by_ifindex = g_hash_table_new(nm_direct_hash, NULL);
+        count = GPOINTER_TO_SIZE(g_hash_table_lookup(priv->stats.msgs_by_ifindex, ifindex_key));
+        g_hash_table_insert(priv->stats.msgs_by_ifindex, ifindex_key, GSIZE_TO_POINTER(count + 1));
+    }
+
     if (!is_del
         && NM_IN_SET(msghdr->nlmsg_type,
                      RTM_NEWADDR,
@@ -6922,6 +7751,8 @@ event_valid_msg(NMPlatform *platform, struct nl_msg *msg, gboolean handle_events
                                NULL,
                                0));
 
+    start_ns = nm_utils_get_monotonic_timestamp_nsec();
+
     {
         nm_auto_nmpobj const NMPObject *obj_old = NULL;
         nm_auto_nmpobj const NMPObject *obj_new = NULL;
@@ -6952,7 +7783,6 @@ event_valid_msg(NMPlatform *platform, struct nl_msg *msg, gboolean handle_events
             is_ipv6 = NMP_OBJECT_GET_TYPE(obj) == NMP_OBJECT_TYPE_IP6_ROUTE;
             if (is_ipv6 || NM_FLAGS_HAS(obj->ip_route.r_rtm_flags, RTM_F_CLONED)) {
                 nm_assert(is_ipv6 || !nmp_object_is_alive(obj));
-                priv = NM_LINUX_PLATFORM_GET_PRIVATE(platform);
                 if (NM_FLAGS_HAS(priv->delayed_action.flags,
                                  DELAYED_ACTION_TYPE_WAIT_FOR_NL_RESPONSE)) {
                     guint i;
@@ -7047,6 +7877,9 @@ event_valid_msg(NMPlatform *platform, struct nl_msg *msg, gboolean handle_events
             break;
         }
     }
+
+    _stats_histogram_add(&priv->stats.cache_update,
+                         nm_utils_get_monotonic_timestamp_nsec() - start_ns);
 }
 
 /*****************************************************************************/
@@ -7859,18 +8692,18 @@ nla_put_failure:
 }
 
 static gboolean
-link_set_bridge_vlans(NMPlatform *                       platform,
-                      int                                ifindex,
-                      gboolean                           on_master,
-                      const NMPlatformBridgeVlan *const *vlans)
+_link_change_bridge_vlans(NMPlatform *                       platform,
+                          int                                nlmsg_type,
+                          int                                ifindex,
+                          gboolean                           on_master,
+                          const NMPlatformBridgeVlan *const *vlans)
 {
     nm_auto_nlmsg struct nl_msg *nlmsg = NULL;
     struct nlattr *              list;
     struct bridge_vlan_info      vinfo = {};
     guint                        i;
 
-    nlmsg =
-        _nl_msg_new_link_full(vlans ? RTM_SETLINK : RTM_DELLINK, 0, ifindex, NULL, AF_BRIDGE, 0, 0);
+    nlmsg = _nl_msg_new_link_full(nlmsg_type, 0, ifindex, NULL, AF_BRIDGE, 0, 0);
     if (!nlmsg)
         g_return_val_if_reached(-NME_BUG);
 
@@ -7880,7 +8713,6 @@ link_set_bridge_vlans(NMPlatform *                       platform,
     NLA_PUT_U16(nlmsg, IFLA_BRIDGE_FLAGS, on_master ? BRIDGE_FLAGS_MASTER : BRIDGE_FLAGS_SELF);
 
     if (vlans) {
-        /* Add VLANs */
         for (i = 0; vlans[i]; i++) {
             const NMPlatformBridgeVlan *vlan     = vlans[i];
             gboolean                    is_range = vlan->vid_start != vlan->vid_end;
@@ -7903,6 +8735,8 @@ link_set_bridge_vlans(NMPlatform *                       platform,
         }
     } else {
         /* Flush existing VLANs */
+        nm_assert(nlmsg_type == RTM_DELLINK);
+
         vinfo.vid   = 1;
         vinfo.flags = BRIDGE_VLAN_INFO_RANGE_BEGIN;
         NLA_PUT(nlmsg, IFLA_BRIDGE_VLAN_INFO, sizeof(vinfo), &vinfo);
@@ -7919,6 +8753,79 @@ nla_put_failure:
     g_return_val_if_reached(FALSE);
 }
 
+static gboolean
+link_set_bridge_vlans(NMPlatform *                       platform,
+                      int                                ifindex,
+                      gboolean                           on_master,
+                      const NMPlatformBridgeVlan *const *vlans)
+{
+    return _link_change_bridge_vlans(platform,
+                                     vlans ? RTM_SETLINK : RTM_DELLINK,
+                                     ifindex,
+                                     on_master,
+                                     vlans);
+}
+
+static gboolean
+link_del_bridge_vlans(NMPlatform *                       platform,
+                      int                                ifindex,
+                      gboolean                           on_master,
+                      const NMPlatformBridgeVlan *const *vlans)
+{
+    g_return_val_if_fail(vlans, FALSE);
+
+    return _link_change_bridge_vlans(platform, RTM_DELLINK, ifindex, on_master, vlans);
+}
+
+static GArray *
+link_get_bridge_vlans(NMPlatform *platform, int ifindex)
+{
+    nm_auto_nlmsg struct nl_msg *nlmsg      = NULL;
+    WaitForNlResponseResult      seq_result = WAIT_FOR_NL_RESPONSE_RESULT_UNKNOWN;
+    gs_free char *               errmsg     = NULL;
+    BridgeVlansGetData           get_data   = {.ifindex = ifindex};
+    char                         s_buf[256];
+    int                          nle;
+
+    /* Kernel only implements the AF_BRIDGE variant of RTM_GETLINK as dump. */
+    nlmsg = _nl_msg_new_link_full(RTM_GETLINK, NLM_F_DUMP, 0, NULL, AF_BRIDGE, 0, 0);
+    if (!nlmsg)
+        g_return_val_if_reached(NULL);
+
+    NLA_PUT_U32(nlmsg, IFLA_EXT_MASK, RTEXT_FILTER_BRVLAN_COMPRESSED);
+
+    get_data.vlans = g_array_new(FALSE, FALSE, sizeof(NMPlatformBridgeVlan));
+
+    nle = _nl_send_nlmsg(platform,
+                         nlmsg,
+                         &seq_result,
+                         &errmsg,
+                         DELAYED_ACTION_RESPONSE_TYPE_BRIDGE_VLANS_GET,
+                         &get_data);
+    if (nle < 0) {
+        _LOGD("link: get-bridge-vlans %d: failed sending netlink request \"%s\" (%d)",
+              ifindex,
+              nm_strerror(nle),
+              -nle);
+        g_array_unref(get_data.vlans);
+        return NULL;
+    }
+
+    delayed_action_handle_all(platform, FALSE);
+
+    if (seq_result != WAIT_FOR_NL_RESPONSE_RESULT_RESPONSE_OK) {
+        _LOGD("link: get-bridge-vlans %d: %s",
+              ifindex,
+              wait_for_nl_response_to_string(seq_result, errmsg, s_buf, sizeof(s_buf)));
+        g_array_unref(get_data.vlans);
+        return NULL;
+    }
+
+    return get_data.vlans;
+nla_put_failure:
+    g_return_val_if_reached(NULL);
+}
+
 static char *
 link_get_physical_port_id(NMPlatform *platform, int ifindex)
 {
@@ -8140,6 +9047,106 @@ link_vlan_change(NMPlatform *            platform,
     return (do_change_link(platform, CHANGE_LINK_TYPE_UNSPEC, ifindex, nlmsg, NULL) >= 0);
 }
 
+static int
+_link_change_info_data(NMPlatform *  platform,
+                       int           ifindex,
+                       NMLinkType    link_type,
+                       gconstpointer props)
+{
+    nm_auto_nlmsg struct nl_msg *nlmsg = NULL;
+    const NMPObject *            obj_cache;
+    gconstpointer                props_old = NULL;
+    struct nlattr *              info;
+    struct nlattr *              data;
+
+    obj_cache = nmp_cache_lookup_link(nm_platform_get_cache(platform), ifindex);
+    if (!obj_cache || !obj_cache->_link.netlink.is_in_netlink) {
+        _LOGD("link: change %d: %s: link does not exist",
+              ifindex,
+              nm_link_type_to_rtnl_type_string(link_type));
+        return -NME_PL_NOT_FOUND;
+    }
+
+    if (obj_cache->link.type == link_type && obj_cache->_link.netlink.lnk
+        && NMP_OBJECT_GET_CLASS(obj_cache->_link.netlink.lnk)->lnk_link_type == link_type)
+        props_old = &obj_cache->_link.netlink.lnk->object;
+
+    nlmsg = _nl_msg_new_link(RTM_NEWLINK, 0, ifindex, NULL);
+    if (!nlmsg)
+        return -NME_UNSPEC;
+
+    if (!(info = nla_nest_start(nlmsg, IFLA_LINKINFO)))
+        goto nla_put_failure;
+
+    NLA_PUT_STRING(nlmsg, IFLA_INFO_KIND, nm_link_type_to_rtnl_type_string(link_type));
+
+    if (!(data = nla_nest_start(nlmsg, IFLA_INFO_DATA)))
+        goto nla_put_failure;
+
+    switch (link_type) {
+    case NM_LINK_TYPE_BOND:
+        if (!_nl_msg_new_link_put_lnk_bond(nlmsg, props, props_old))
+            goto nla_put_failure;
+        break;
+    case NM_LINK_TYPE_BRIDGE:
+        if (!_nl_msg_new_link_put_lnk_bridge(nlmsg, props, props_old))
+            goto nla_put_failure;
+        break;
+    default:
+        g_return_val_if_reached(-NME_BUG);
+    }
+
+    nla_nest_end(nlmsg, data);
+    nla_nest_end(nlmsg, info);
+
+    return do_change_link(platform, CHANGE_LINK_TYPE_UNSPEC, ifindex, nlmsg, NULL);
+nla_put_failure:
+    g_return_val_if_reached(-NME_BUG);
+}
+
+static int
+link_bond_change(NMPlatform *platform, int ifindex, const NMPlatformLnkBond *props)
+{
+    return _link_change_info_data(platform, ifindex, NM_LINK_TYPE_BOND, props);
+}
+
+static int
+link_bridge_change(NMPlatform *platform, int ifindex, const NMPlatformLnkBridge *props)
+{
+    return _link_change_info_data(platform, ifindex, NM_LINK_TYPE_BRIDGE, props);
+}
+
+static gboolean
+link_set_bridge_port(NMPlatform *platform, int ifindex, const NMPlatformBridgePort *props)
+{
+    nm_auto_nlmsg struct nl_msg *nlmsg = NULL;
+    struct nlattr *              info;
+    struct nlattr *              data;
+
+    nlmsg = _nl_msg_new_link(RTM_NEWLINK, 0, ifindex, NULL);
+    if (!nlmsg)
+        return FALSE;
+
+    if (!(info = nla_nest_start(nlmsg, IFLA_LINKINFO)))
+        goto nla_put_failure;
+
+    NLA_PUT_STRING(nlmsg, IFLA_INFO_SLAVE_KIND, "bridge");
+
+    if (!(data = nla_nest_start(nlmsg, IFLA_INFO_SLAVE_DATA)))
+        goto nla_put_failure;
+
+    NLA_PUT_U16(nlmsg, IFLA_BRPORT_PRIORITY, props->priority);
+    NLA_PUT_U32(nlmsg, IFLA_BRPORT_COST, props->path_cost);
+    NLA_PUT_U8(nlmsg, IFLA_BRPORT_MODE, !!props->hairpin_mode);
+
+    nla_nest_end(nlmsg, data);
+    nla_nest_end(nlmsg, info);
+
+    return (do_change_link(platform, CHANGE_LINK_TYPE_UNSPEC, ifindex, nlmsg, NULL) >= 0);
+nla_put_failure:
+    g_return_val_if_reached(FALSE);
+}
+
 static gboolean
 link_enslave(NMPlatform *platform, int master, int slave)
 {
@@ -9161,6 +10168,7 @@ event_handler_read_netlink(NMPlatform *platform, gboolean wait_for_acks)
                               }
                               _reason;
                           }));
+                    priv->stats.overflows++;
                     event_handler_recvmsgs(platform, FALSE);
                     delayed_action_wait_for_nl_response_complete_all(
                         platform,
@@ -9596,6 +10604,12 @@ finalize(GObject *object)
         g_hash_table_destroy(priv->sysctl_get_prev_values);
     }
 
+    nm_clear_pointer(&priv->stats.msgs_by_ifindex, g_hash_table_unref);
+
+    /* don't wait. There are no pending requests, as they keep us alive. */
+    if (priv->sysctl_async_pool)
+        g_thread_pool_free(priv->sysctl_async_pool, TRUE, FALSE);
+
     priv->udev_client = nm_udev_client_unref(priv->udev_client);
 
     G_OBJECT_CLASS(nm_linux_platform_parent_class)->finalize(object);
@@ -9637,6 +10651,13 @@ nm_linux_platform_class_init(NMLinuxPlatformClass *klass)
     platform_class->link_set_sriov_params_async = link_set_sriov_params_async;
     platform_class->link_set_sriov_vfs          = link_set_sriov_vfs;
     platform_class->link_set_bridge_vlans       = link_set_bridge_vlans;
+    platform_class->link_del_bridge_vlans       = link_del_bridge_vlans;
+    platform_class->link_get_bridge_vlans       = link_get_bridge_vlans;
+
+    platform_class->ethtool_get_ring     = ethtool_get_ring;
+    platform_class->ethtool_set_ring     = ethtool_set_ring;
+    platform_class->ethtool_get_coalesce = ethtool_get_coalesce;
+    platform_class->ethtool_set_coalesce = ethtool_set_coalesce;
 
     platform_class->link_get_physical_port_id = link_get_physical_port_id;
     platform_class->link_get_dev_id           = link_get_dev_id;
@@ -9652,6 +10673,9 @@ nm_linux_platform_class_init(NMLinuxPlatformClass *klass)
 
     platform_class->link_can_assume = link_can_assume;
 
+    platform_class->link_bond_change      = link_bond_change;
+    platform_class->link_bridge_change    = link_bridge_change;
+    platform_class->link_set_bridge_port  = link_set_bridge_port;
     platform_class->link_vlan_change      = link_vlan_change;
     platform_class->link_wireguard_change = link_wireguard_change;
 
@@ -9696,4 +10720,5 @@ nm_linux_platform_class_init(NMLinuxPlatformClass *klass)
     platform_class->tfilter_add = tfilter_add;
 
     platform_class->process_events = process_events;
+    platform_class->get_stats      = get_stats;
 }
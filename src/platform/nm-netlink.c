@@ -74,92 +74,73 @@ NM_UTILS_FLAGS2STR_DEFINE(nl_nlmsg_flags2str,
 /*****************************************************************************/
 
 const char *
-nl_nlmsghdr_to_str(const struct nlmsghdr *hdr, char *buf, gsize len)
+nl_nlmsg_type_to_string(guint16 type)
 {
-    const char *b;
-    const char *s;
-    guint       flags, flags_before;
-    const char *prefix;
-
-    if (!nm_utils_to_string_buffer_init_null(hdr, &buf, &len))
-        return buf;
-
-    b = buf;
-
-    switch (hdr->nlmsg_type) {
+    switch (type) {
     case RTM_GETLINK:
-        s = "RTM_GETLINK";
-        break;
+        return "RTM_GETLINK";
     case RTM_NEWLINK:
-        s = "RTM_NEWLINK";
-        break;
+        return "RTM_NEWLINK";
     case RTM_DELLINK:
-        s = "RTM_DELLINK";
-        break;
+        return "RTM_DELLINK";
     case RTM_SETLINK:
-        s = "RTM_SETLINK";
-        break;
+        return "RTM_SETLINK";
     case RTM_GETADDR:
-        s = "RTM_GETADDR";
-        break;
+        return "RTM_GETADDR";
     case RTM_NEWADDR:
-        s = "RTM_NEWADDR";
-        break;
+        return "RTM_NEWADDR";
     case RTM_DELADDR:
-        s = "RTM_DELADDR";
-        break;
+        return "RTM_DELADDR";
     case RTM_GETROUTE:
-        s = "RTM_GETROUTE";
-        break;
+        return "RTM_GETROUTE";
     case RTM_NEWROUTE:
-        s = "RTM_NEWROUTE";
-        break;
+        return "RTM_NEWROUTE";
     case RTM_DELROUTE:
-        s = "RTM_DELROUTE";
-        break;
+        return "RTM_DELROUTE";
     case RTM_GETRULE:
-        s = "RTM_GETRULE";
-        break;
+        return "RTM_GETRULE";
     case RTM_NEWRULE:
-        s = "RTM_NEWRULE";
-        break;
+        return "RTM_NEWRULE";
     case RTM_DELRULE:
-        s = "RTM_DELRULE";
-        break;
+        return "RTM_DELRULE";
     case RTM_GETQDISC:
-        s = "RTM_GETQDISC";
-        break;
+        return "RTM_GETQDISC";
     case RTM_NEWQDISC:
-        s = "RTM_NEWQDISC";
-        break;
+        return "RTM_NEWQDISC";
     case RTM_DELQDISC:
-        s = "RTM_DELQDISC";
-        break;
+        return "RTM_DELQDISC";
     case RTM_GETTFILTER:
-        s = "RTM_GETTFILTER";
-        break;
+        return "RTM_GETTFILTER";
     case RTM_NEWTFILTER:
-        s = "RTM_NEWTFILTER";
-        break;
+        return "RTM_NEWTFILTER";
     case RTM_DELTFILTER:
-        s = "RTM_DELTFILTER";
-        break;
+        return "RTM_DELTFILTER";
     case NLMSG_NOOP:
-        s = "NLMSG_NOOP";
-        break;
+        return "NLMSG_NOOP";
     case NLMSG_ERROR:
-        s = "NLMSG_ERROR";
-        break;
+        return "NLMSG_ERROR";
     case NLMSG_DONE:
-        s = "NLMSG_DONE";
-        break;
+        return "NLMSG_DONE";
     case NLMSG_OVERRUN:
-        s = "NLMSG_OVERRUN";
-        break;
-    default:
-        s = NULL;
-        break;
+        return "NLMSG_OVERRUN";
     }
+    return NULL;
+}
+
+const char *
+nl_nlmsghdr_to_str(const struct nlmsghdr *hdr, char *buf, gsize len)
+{
+    const char *b;
+    const char *s;
+    guint       flags, flags_before;
+    const char *prefix;
+
+    if (!nm_utils_to_string_buffer_init_null(hdr, &buf, &len))
+        return buf;
+
+    b = buf;
+
+    s = nl_nlmsg_type_to_string(hdr->nlmsg_type);
 
     if (s)
         nm_utils_strbuf_append_str(&buf, &len, s);
@@ -57,6 +57,8 @@ const char *nl_nlmsgtype2str(int type, char *buf, size_t size);
 
 const char *nl_nlmsg_flags2str(int flags, char *buf, size_t len);
 
+const char *nl_nlmsg_type_to_string(guint16 type);
+
 const char *nl_nlmsghdr_to_str(const struct nlmsghdr *hdr, char *buf, gsize len);
 
 /*****************************************************************************/
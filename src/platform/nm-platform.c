@@ -33,6 +33,7 @@
 #include "nm-platform-private.h"
 #include "nmp-object.h"
 #include "nmp-netns.h"
+#include "nm-netlink.h"
 
 /*****************************************************************************/
 
@@ -462,6 +463,45 @@ nm_platform_process_events(NMPlatform *self)
         klass->process_events(self);
 }
 
+/**
+ * nm_platform_get_stats:
+ * @self: platform instance
+ *
+ * Returns: the counters about the netlink events that were handled by
+ *   the platform instance, or %NULL if the platform does not track them.
+ */
+const NMPlatformStats *
+nm_platform_get_stats(NMPlatform *self)
+{
+    _CHECK_SELF(self, klass, NULL);
+
+    if (!klass->get_stats)
+        return NULL;
+    return klass->get_stats(self);
+}
+
+/**
+ * nm_platform_stats_msg_type_to_string:
+ * @type: the netlink message type, as index into #NMPlatformStats.msgs_by_type
+ * @buf: buffer for the numeric fallback
+ * @len: the size of @buf
+ *
+ * Returns: the name of the message type (like "RTM_NEWLINK"), or the
+ *   number printed to @buf, for types without a name.
+ */
+const char *
+nm_platform_stats_msg_type_to_string(guint16 type, char *buf, gsize len)
+{
+    const char *s;
+
+    s = nl_nlmsg_type_to_string(type);
+    if (s)
+        return s;
+
+    g_snprintf(buf, len, "%u", (guint) type);
+    return buf;
+}
+
 const NMPlatformLink *
 nm_platform_process_events_ensure_link(NMPlatform *self, int ifindex, const char *ifname)
 {
@@ -1917,6 +1957,313 @@ nm_platform_link_set_bridge_vlans(NMPlatform *                       self,
     return klass->link_set_bridge_vlans(self, ifindex, on_master, vlans);
 }
 
+/**
+ * nm_platform_link_get_bridge_vlans:
+ * @self: platform instance
+ * @ifindex: the ifindex of the bridge or bridge port
+ *
+ * Queries the kernel for the VLANs of a bridge or bridge port. The
+ * VLANs are not tracked by the platform cache, so this always issues
+ * a netlink request.
+ *
+ * Returns: (transfer full): an array of #NMPlatformBridgeVlan, or %NULL
+ *   on failure or if not supported by the platform.
+ */
+GArray *
+nm_platform_link_get_bridge_vlans(NMPlatform *self, int ifindex)
+{
+    _CHECK_SELF(self, klass, NULL);
+
+    g_return_val_if_fail(ifindex > 0, NULL);
+
+    if (!klass->link_get_bridge_vlans)
+        return NULL;
+
+    return klass->link_get_bridge_vlans(self, ifindex);
+}
+
+#define BRIDGE_VLAN_STATE_PRESENT  ((guint8) 0x01)
+#define BRIDGE_VLAN_STATE_UNTAGGED ((guint8) 0x02)
+#define BRIDGE_VLAN_STATE_PVID     ((guint8) 0x04)
+
+static void
+_bridge_vlans_to_state(guint8 *state, const NMPlatformBridgeVlan *vlan, guint *pvid)
+{
+    guint vid;
+    guint vid_start = NM_MAX(vlan->vid_start, 1u);
+    guint vid_end   = NM_MIN(vlan->vid_end, 4094u);
+
+    for (vid = vid_start; vid <= vid_end; vid++) {
+        state[vid] = BRIDGE_VLAN_STATE_PRESENT;
+        if (vlan->untagged)
+            state[vid] |= BRIDGE_VLAN_STATE_UNTAGGED;
+    }
+
+    /* Like kernel, adding a VLAN with PVID flag makes it the new PVID, while
+     * adding the current PVID VLAN without the flag clears the PVID. */
+    if (vlan->pvid)
+        *pvid = vid_start;
+    else if (*pvid >= vid_start && *pvid <= vid_end)
+        *pvid = 0;
+}
+
+static const NMPlatformBridgeVlan **
+_bridge_vlans_from_state(const guint8 *state_old, const guint8 *state_new, gboolean add)
+{
+    GArray *              ranges;
+    NMPlatformBridgeVlan *range = NULL;
+    guint8                flags = 0;
+    guint                 vid;
+
+    ranges = g_array_new(FALSE, FALSE, sizeof(NMPlatformBridgeVlan));
+
+    for (vid = 1; vid <= 4094; vid++) {
+        gboolean selected;
+
+        if (add)
+            selected = state_new[vid] && state_new[vid] != state_old[vid];
+        else
+            selected = state_old[vid] && !state_new[vid];
+
+        if (!selected) {
+            range = NULL;
+            continue;
+        }
+
+        if (range && state_new[vid] == flags && !(flags & BRIDGE_VLAN_STATE_PVID)
+            && range->vid_end + 1u == vid) {
+            range->vid_end = vid;
+            continue;
+        }
+
+        flags = state_new[vid];
+        g_array_append_val(ranges,
+                           ((NMPlatformBridgeVlan){
+                               .vid_start = vid,
+                               .vid_end   = vid,
+                               .untagged  = add && (flags & BRIDGE_VLAN_STATE_UNTAGGED),
+                               .pvid      = add && (flags & BRIDGE_VLAN_STATE_PVID),
+                           }));
+        range = &g_array_index(ranges, NMPlatformBridgeVlan, ranges->len - 1);
+    }
+
+    if (ranges->len == 0) {
+        g_array_unref(ranges);
+        return NULL;
+    }
+
+    /* Return a NULL terminated list of pointers, followed by the data. */
+    {
+        const NMPlatformBridgeVlan **arr;
+        NMPlatformBridgeVlan *       p_data;
+        guint                        i;
+
+        arr    = g_malloc((sizeof(NMPlatformBridgeVlan *) * (ranges->len + 1))
+                       + (sizeof(NMPlatformBridgeVlan) * ranges->len));
+        p_data = (NMPlatformBridgeVlan *) &arr[ranges->len + 1];
+        for (i = 0; i < ranges->len; i++) {
+            p_data[i] = g_array_index(ranges, NMPlatformBridgeVlan, i);
+            arr[i]    = &p_data[i];
+        }
+        arr[i] = NULL;
+        g_array_unref(ranges);
+        return arr;
+    }
+}
+
+/**
+ * nm_platform_link_sync_bridge_vlans:
+ * @self: platform instance
+ * @ifindex: the ifindex of the bridge or bridge port
+ * @on_master: whether to configure the VLANs of a port on the bridge master
+ * @vlans: (allow-none): %NULL terminated list of VLANs to configure
+ *
+ * Changes the VLANs of the bridge (or port) to @vlans. The entries are
+ * applied in order, so a later entry overrides the flags of an earlier one.
+ * Only the VLANs that are not configured as requested are removed and added,
+ * so that VLANs which stay unchanged don't interrupt traffic.
+ *
+ * If the current VLANs cannot be retrieved, all VLANs get flushed and
+ * @vlans is added.
+ *
+ * Returns: %TRUE on success.
+ */
+gboolean
+nm_platform_link_sync_bridge_vlans(NMPlatform *                       self,
+                                   int                                ifindex,
+                                   gboolean                           on_master,
+                                   const NMPlatformBridgeVlan *const *vlans)
+{
+    gs_unref_array GArray *current           = NULL;
+    gs_free guint8 *state_old                = NULL;
+    gs_free guint8 *state_new                = NULL;
+    gs_free const NMPlatformBridgeVlan **del = NULL;
+    gs_free const NMPlatformBridgeVlan **add = NULL;
+    guint                                pvid;
+    guint                                i;
+
+    _CHECK_SELF(self, klass, FALSE);
+
+    g_return_val_if_fail(ifindex > 0, FALSE);
+
+    if (klass->link_del_bridge_vlans)
+        current = nm_platform_link_get_bridge_vlans(self, ifindex);
+
+    if (!current) {
+        if (!nm_platform_link_set_bridge_vlans(self, ifindex, on_master, NULL))
+            return FALSE;
+        return !vlans || !vlans[0]
+               || nm_platform_link_set_bridge_vlans(self, ifindex, on_master, vlans);
+    }
+
+    state_old = g_new0(guint8, 4095);
+    state_new = g_new0(guint8, 4095);
+
+    pvid = 0;
+    for (i = 0; i < current->len; i++) {
+        _bridge_vlans_to_state(state_old,
+                               &g_array_index(current, NMPlatformBridgeVlan, i),
+                               &pvid);
+    }
+    if (pvid)
+        state_old[pvid] |= BRIDGE_VLAN_STATE_PVID;
+
+    pvid = 0;
+    for (i = 0; vlans && vlans[i]; i++)
+        _bridge_vlans_to_state(state_new, vlans[i], &pvid);
+    if (pvid)
+        state_new[pvid] |= BRIDGE_VLAN_STATE_PVID;
+
+    del = _bridge_vlans_from_state(state_old, state_new, FALSE);
+    add = _bridge_vlans_from_state(state_old, state_new, TRUE);
+
+    _LOG3D("link: sync bridge VLANs on %s: %u present, removing %u and adding %u ranges",
+           on_master ? "master" : "self",
+           current->len,
+           (guint) NM_PTRARRAY_LEN(del),
+           (guint) NM_PTRARRAY_LEN(add));
+
+    if (del) {
+        for (i = 0; del[i]; i++)
+            _LOG3T("link:   remove bridge VLAN %s",
+                   nm_platform_bridge_vlan_to_string(del[i], NULL, 0));
+        if (!klass->link_del_bridge_vlans(self, ifindex, on_master, del))
+            return FALSE;
+    }
+
+    if (add) {
+        for (i = 0; add[i]; i++)
+            _LOG3T("link:   add bridge VLAN %s", nm_platform_bridge_vlan_to_string(add[i], NULL, 0));
+        if (!klass->link_set_bridge_vlans(self, ifindex, on_master, add))
+            return FALSE;
+    }
+
+    return TRUE;
+}
+
+/**
+ * nm_platform_link_bond_change:
+ * @self: platform instance
+ * @ifindex: the ifindex of the bond master
+ * @props: the requested bond options
+ *
+ * Sets all bond options with a single RTM_NEWLINK request. Only the
+ * attributes that differ from the cached lnk object are sent to the
+ * kernel.
+ *
+ * Returns: 0 on success or a negative error code. -NME_PL_OPNOTSUPP
+ *   means the caller should fall back to configure the options via sysfs.
+ */
+int
+nm_platform_link_bond_change(NMPlatform *self, int ifindex, const NMPlatformLnkBond *props)
+{
+    const NMPlatformLnkBond *lnk;
+
+    _CHECK_SELF(self, klass, -NME_BUG);
+
+    g_return_val_if_fail(ifindex > 0, -NME_BUG);
+    g_return_val_if_fail(props, -NME_BUG);
+
+    if (!klass->link_bond_change)
+        return -NME_PL_OPNOTSUPP;
+
+    lnk = nm_platform_link_get_lnk_bond(self, ifindex, NULL);
+    if (lnk && nm_platform_lnk_bond_cmp(lnk, props) == 0) {
+        _LOG3T("link: bond options are already up to date");
+        return 0;
+    }
+
+    _LOG3D("link: change bond: %s", nm_platform_lnk_bond_to_string(props, NULL, 0));
+
+    return klass->link_bond_change(self, ifindex, props);
+}
+
+/**
+ * nm_platform_link_bridge_change:
+ * @self: platform instance
+ * @ifindex: the ifindex of the bridge
+ * @props: the requested bridge options
+ *
+ * Like nm_platform_link_bond_change(), but for the IFLA_BR_* attributes
+ * of a bridge.
+ *
+ * Returns: 0 on success or a negative error code.
+ */
+int
+nm_platform_link_bridge_change(NMPlatform *self, int ifindex, const NMPlatformLnkBridge *props)
+{
+    const NMPlatformLnkBridge *lnk;
+
+    _CHECK_SELF(self, klass, -NME_BUG);
+
+    g_return_val_if_fail(ifindex > 0, -NME_BUG);
+    g_return_val_if_fail(props, -NME_BUG);
+
+    if (!klass->link_bridge_change)
+        return -NME_PL_OPNOTSUPP;
+
+    lnk = nm_platform_link_get_lnk_bridge(self, ifindex, NULL);
+    if (lnk && nm_platform_lnk_bridge_cmp(lnk, props) == 0) {
+        _LOG3T("link: bridge options are already up to date");
+        return 0;
+    }
+
+    _LOG3D("link: change bridge: %s", nm_platform_lnk_bridge_to_string(props, NULL, 0));
+
+    return klass->link_bridge_change(self, ifindex, props);
+}
+
+/**
+ * nm_platform_link_set_bridge_port:
+ * @self: platform instance
+ * @ifindex: the ifindex of the bridge port
+ * @props: the bridge port options
+ *
+ * Sets the IFLA_BRPORT_* options of an enslaved bridge port with a
+ * single request.
+ *
+ * Returns: %TRUE on success. %FALSE also if the platform does not support
+ *   this, in which case the caller should fall back to sysfs.
+ */
+gboolean
+nm_platform_link_set_bridge_port(NMPlatform *                self,
+                                 int                         ifindex,
+                                 const NMPlatformBridgePort *props)
+{
+    _CHECK_SELF(self, klass, FALSE);
+
+    g_return_val_if_fail(ifindex > 0, FALSE);
+    g_return_val_if_fail(props, FALSE);
+
+    if (!klass->link_set_bridge_port)
+        return FALSE;
+
+    _LOG3D("link: setting bridge port options %s",
+           nm_platform_bridge_port_to_string(props, NULL, 0));
+
+    return klass->link_set_bridge_port(self, ifindex, props);
+}
+
 /**
  * nm_platform_link_set_up:
  * @self: platform instance
@@ -2279,6 +2626,12 @@ _link_get_lnk(NMPlatform *self, int ifindex, NMLinkType link_type, const NMPlatf
     return lnk ? &lnk->object : NULL;
 }
 
+const NMPlatformLnkBond *
+nm_platform_link_get_lnk_bond(NMPlatform *self, int ifindex, const NMPlatformLink **out_link)
+{
+    return _link_get_lnk(self, ifindex, NM_LINK_TYPE_BOND, out_link);
+}
+
 const NMPlatformLnkBridge *
 nm_platform_link_get_lnk_bridge(NMPlatform *self, int ifindex, const NMPlatformLink **out_link)
 {
@@ -3366,6 +3719,15 @@ nm_platform_ethtool_get_link_coalesce(NMPlatform *            self,
     g_return_val_if_fail(ifindex > 0, FALSE);
     g_return_val_if_fail(coalesce, FALSE);
 
+    if (klass->ethtool_get_coalesce) {
+        int r;
+
+        /* Prefer ethtool netlink. Fall back to ioctl if the kernel does not support it. */
+        r = klass->ethtool_get_coalesce(self, ifindex, coalesce);
+        if (r != -NME_PL_OPNOTSUPP)
+            return r >= 0;
+    }
+
     return nmp_utils_ethtool_get_coalesce(ifindex, coalesce);
 }
 
@@ -3378,6 +3740,14 @@ nm_platform_ethtool_set_coalesce(NMPlatform *                  self,
 
     g_return_val_if_fail(ifindex > 0, FALSE);
 
+    if (klass->ethtool_set_coalesce) {
+        int r;
+
+        r = klass->ethtool_set_coalesce(self, ifindex, coalesce);
+        if (r != -NME_PL_OPNOTSUPP)
+            return r >= 0;
+    }
+
     return nmp_utils_ethtool_set_coalesce(ifindex, coalesce);
 }
 
@@ -3389,6 +3759,14 @@ nm_platform_ethtool_get_link_ring(NMPlatform *self, int ifindex, NMEthtoolRingSt
     g_return_val_if_fail(ifindex > 0, FALSE);
     g_return_val_if_fail(ring, FALSE);
 
+    if (klass->ethtool_get_ring) {
+        int r;
+
+        r = klass->ethtool_get_ring(self, ifindex, ring);
+        if (r != -NME_PL_OPNOTSUPP)
+            return r >= 0;
+    }
+
     return nmp_utils_ethtool_get_ring(ifindex, ring);
 }
 
@@ -3399,6 +3777,14 @@ nm_platform_ethtool_set_ring(NMPlatform *self, int ifindex, const NMEthtoolRingS
 
     g_return_val_if_fail(ifindex > 0, FALSE);
 
+    if (klass->ethtool_set_ring) {
+        int r;
+
+        r = klass->ethtool_set_ring(self, ifindex, ring);
+        if (r != -NME_PL_OPNOTSUPP)
+            return r >= 0;
+    }
+
     return nmp_utils_ethtool_set_ring(ifindex, ring);
 }
 
@@ -4372,7 +4758,18 @@ nm_platform_ip_route_get_prune_list(NMPlatform *           self,
                         NM_IP_ROUTE_TABLE_SYNC_MODE_FULL,
                         NM_IP_ROUTE_TABLE_SYNC_MODE_ALL));
 
-    nmp_lookup_init_object(&lookup, NMP_OBJECT_TYPE_IP_ROUTE(NM_IS_IPv4(addr_family)), ifindex);
+    if (route_table_sync == NM_IP_ROUTE_TABLE_SYNC_MODE_MAIN) {
+        /* Only the main table is of interest. Look it up via its own index, so that
+         * the cost does not depend on the number of routes in other tables. */
+        nmp_lookup_init_route_by_ifindex_table(&lookup,
+                                               NMP_OBJECT_TYPE_IP_ROUTE(NM_IS_IPv4(addr_family)),
+                                               ifindex,
+                                               RT_TABLE_MAIN);
+    } else {
+        nmp_lookup_init_object(&lookup,
+                               NMP_OBJECT_TYPE_IP_ROUTE(NM_IS_IPv4(addr_family)),
+                               ifindex);
+    }
     head_entry = nm_platform_lookup(self, &lookup);
     if (!head_entry)
         return NULL;
@@ -4387,9 +4784,8 @@ nm_platform_ip_route_get_prune_list(NMPlatform *           self,
                 == RT_TABLE_LOCAL)
                 continue;
         } else if (route_table_sync == NM_IP_ROUTE_TABLE_SYNC_MODE_MAIN) {
-            if (!nm_platform_route_table_is_main(
-                    nm_platform_ip_route_get_effective_table(NMP_OBJECT_CAST_IP_ROUTE(obj))))
-                continue;
+            nm_assert(nm_platform_route_table_is_main(
+                nm_platform_ip_route_get_effective_table(NMP_OBJECT_CAST_IP_ROUTE(obj))));
         } else
             nm_assert(route_table_sync == NM_IP_ROUTE_TABLE_SYNC_MODE_ALL);
 
@@ -4403,6 +4799,21 @@ nm_platform_ip_route_get_prune_list(NMPlatform *           self,
     return routes_prune;
 }
 
+static const NMPObject *
+_route_sync_get_replace_target(NMPlatform *self, const NMPObject *conf_o)
+{
+    const NMDedupMultiHeadEntry *head_entry;
+
+    /* For NLM_F_REPLACE, kernel identifies the route to replace by the fields of
+     * the weak-id (table, destination, tos/source and metric), and replaces the
+     * first match. That is only predictable, if there is only one such route. */
+    head_entry = nm_platform_lookup_all(self, NMP_CACHE_ID_TYPE_ROUTES_BY_WEAK_ID, conf_o);
+    if (!head_entry || head_entry->len != 1)
+        return NULL;
+
+    return c_list_entry(head_entry->lst_entries_head.next, NMDedupMultiEntry, lst_entries)->obj;
+}
+
 /**
  * nm_platform_ip_route_sync:
  * @self: the #NMPlatform instance.
@@ -4430,7 +4841,8 @@ nm_platform_ip_route_sync(NMPlatform *self,
 {
     const int                    IS_IPv4 = NM_IS_IPv4(addr_family);
     const NMPlatformVTableRoute *vt;
-    gs_unref_hashtable GHashTable *routes_idx = NULL;
+    gs_unref_hashtable GHashTable *routes_idx       = NULL;
+    gs_unref_hashtable GHashTable *routes_prune_idx = NULL;
     const NMPObject *              conf_o;
     const NMDedupMultiEntry *      plat_entry;
     guint                          i;
@@ -4444,10 +4856,36 @@ nm_platform_ip_route_sync(NMPlatform *self,
 
     vt = &nm_platform_vtable_route.vx[IS_IPv4];
 
+    /* First collect all the routes that we want to have configured. We need to know
+     * the full set before adding anything, to decide which existing routes can be
+     * replaced in one step. */
+    for (i = 0; routes && i < routes->len; i++) {
+        conf_o = routes->pdata[i];
+
+        if (!routes_idx) {
+            routes_idx = g_hash_table_new((GHashFunc) nmp_object_id_hash,
+                                          (GEqualFunc) nmp_object_id_equal);
+        }
+        if (g_hash_table_contains(routes_idx, conf_o)) {
+            _LOG3D("route-sync: skip adding duplicate route %s",
+                   nmp_object_to_string(conf_o, NMP_OBJECT_TO_STRING_PUBLIC, sbuf1, sizeof(sbuf1)));
+            continue;
+        }
+        g_hash_table_add(routes_idx, (gpointer) conf_o);
+    }
+
+    if (routes_idx && routes_prune && routes_prune->len > 0) {
+        routes_prune_idx = g_hash_table_new((GHashFunc) nmp_object_id_hash,
+                                            (GEqualFunc) nmp_object_id_equal);
+        for (i = 0; i < routes_prune->len; i++)
+            g_hash_table_add(routes_prune_idx, routes_prune->pdata[i]);
+    }
+
     for (i_type = 0; routes && i_type < 2; i_type++) {
         for (i = 0; i < routes->len; i++) {
-            int      r, r2;
-            gboolean gateway_route_added = FALSE;
+            NMPNlmFlags nlmflags;
+            int         r, r2;
+            gboolean    gateway_route_added = FALSE;
 
             conf_o = routes->pdata[i];
 
@@ -4463,16 +4901,8 @@ nm_platform_ip_route_sync(NMPlatform *self,
                 continue;
             }
 
-            if (!routes_idx) {
-                routes_idx = g_hash_table_new((GHashFunc) nmp_object_id_hash,
-                                              (GEqualFunc) nmp_object_id_equal);
-            }
-            if (!g_hash_table_insert(routes_idx, (gpointer) conf_o, (gpointer) conf_o)) {
-                _LOG3D("route-sync: skip adding duplicate route %s",
-                       nmp_object_to_string(conf_o,
-                                            NMP_OBJECT_TO_STRING_PUBLIC,
-                                            sbuf1,
-                                            sizeof(sbuf1)));
+            if (g_hash_table_lookup(routes_idx, conf_o) != conf_o) {
+                /* a duplicate. Already logged above. */
                 continue;
             }
 
@@ -4484,6 +4914,8 @@ nm_platform_ip_route_sync(NMPlatform *self,
                 continue;
             }
 
+            nlmflags = NMP_NLM_FLAG_APPEND;
+
             plat_entry = nm_platform_lookup_entry(self, NMP_CACHE_ID_TYPE_OBJECT_TYPE, conf_o);
             if (plat_entry) {
                 const NMPObject *plat_o;
@@ -4497,16 +4929,29 @@ nm_platform_ip_route_sync(NMPlatform *self,
                     continue;
 
                 /* we need to replace the existing route with a (slightly) different
-                 * one. Delete it first. */
-                if (!nm_platform_object_delete(self, plat_o)) {
+                 * one. If it is the only route with this weak-id, kernel will pick
+                 * it for NLM_F_REPLACE and we can update it atomically. Otherwise,
+                 * delete it first. */
+                if (_route_sync_get_replace_target(self, conf_o) == plat_o)
+                    nlmflags = NMP_NLM_FLAG_REPLACE;
+                else if (!nm_platform_object_delete(self, plat_o)) {
                     /* ignore error. */
                 }
+            } else if (routes_prune_idx) {
+                const NMPObject *replace_o;
+
+                /* a new route. If there is exactly one other route with the same weak-id,
+                 * which we are about to prune anyway, replace it in one step instead of
+                 * adding the new one and deleting the old one afterwards. */
+                replace_o = _route_sync_get_replace_target(self, conf_o);
+                if (replace_o && !g_hash_table_contains(routes_idx, replace_o)
+                    && g_hash_table_contains(routes_prune_idx, replace_o))
+                    nlmflags = NMP_NLM_FLAG_REPLACE;
             }
 
 sync_route_add:
             r = nm_platform_ip_route_add(self,
-                                         NMP_NLM_FLAG_APPEND
-                                             | NMP_NLM_FLAG_SUPPRESS_NETLINK_FAILURE,
+                                         nlmflags | NMP_NLM_FLAG_SUPPRESS_NETLINK_FAILURE,
                                          conf_o);
             if (r < 0) {
                 if (r == -EEXIST) {
@@ -4656,7 +5101,7 @@ sync_route_add:
                       || (!NM_IS_IPv4(addr_family)
                           && NMP_OBJECT_GET_TYPE(prune_o) == NMP_OBJECT_TYPE_IP6_ROUTE));
 
-            if (routes_idx && g_hash_table_lookup(routes_idx, prune_o))
+            if (routes_idx && g_hash_table_contains(routes_idx, prune_o))
                 continue;
 
             if (!nm_platform_lookup_entry(self, NMP_CACHE_ID_TYPE_OBJECT_TYPE, prune_o))
@@ -5562,6 +6007,82 @@ nm_platform_link_to_string(const NMPlatformLink *link, char *buf, gsize len)
     return buf;
 }
 
+const char *
+nm_platform_lnk_bond_to_string(const NMPlatformLnkBond *lnk, char *buf, gsize len)
+{
+    char  sbuf[NM_UTILS_INET_ADDRSTRLEN];
+    char *b;
+    guint i;
+
+    if (!nm_utils_to_string_buffer_init_null(lnk, &buf, &len))
+        return buf;
+
+    b = buf;
+    nm_utils_strbuf_append(&b,
+                           &len,
+                           "bond"
+                           " mode %u"
+                           " primary %d"
+                           " miimon %u"
+                           " updelay %u"
+                           " downdelay %u"
+                           " arp_interval %u"
+                           " arp_validate %u"
+                           " arp_all_targets %u"
+                           " primary_reselect %u"
+                           " fail_over_mac %u"
+                           " xmit_hash_policy %u"
+                           " resend_igmp %u"
+                           " num_grat_arp %u"
+                           " all_slaves_active %d"
+                           " min_links %u"
+                           " lp_interval %u"
+                           " packets_per_slave %u"
+                           " lacp_rate %u"
+                           " ad_select %u"
+                           " ad_actor_sys_prio %u"
+                           " ad_user_port_key %u"
+                           " ad_actor_system " NM_ETHER_ADDR_FORMAT_STR " tlb_dynamic_lb %d"
+                           " use_carrier %d"
+                           " arp_ip_target",
+                           lnk->mode,
+                           lnk->primary,
+                           lnk->miimon,
+                           lnk->updelay,
+                           lnk->downdelay,
+                           lnk->arp_interval,
+                           lnk->arp_validate,
+                           lnk->arp_all_targets,
+                           lnk->primary_reselect,
+                           lnk->fail_over_mac,
+                           lnk->xmit_hash_policy,
+                           lnk->resend_igmp,
+                           lnk->num_grat_arp,
+                           (int) lnk->all_slaves_active,
+                           lnk->min_links,
+                           lnk->lp_interval,
+                           lnk->packets_per_slave,
+                           lnk->lacp_rate,
+                           lnk->ad_select,
+                           lnk->ad_actor_sys_prio,
+                           lnk->ad_user_port_key,
+                           NM_ETHER_ADDR_FORMAT_VAL(&lnk->ad_actor_system),
+                           (int) lnk->tlb_dynamic_lb,
+                           (int) lnk->use_carrier);
+
+    if (lnk->arp_ip_targets_num == 0)
+        nm_utils_strbuf_append_str(&b, &len, " none");
+    for (i = 0; i < lnk->arp_ip_targets_num; i++) {
+        nm_utils_strbuf_append(&b,
+                               &len,
+                               "%s%s",
+                               i == 0 ? " " : ",",
+                               _nm_utils_inet4_ntop(lnk->arp_ip_target[i], sbuf));
+    }
+
+    return buf;
+}
+
 const NMPlatformLnkBridge nm_platform_lnk_bridge_default = {
     .forward_delay                 = NM_BRIDGE_FORWARD_DELAY_DEF_SYS,
     .hello_time                    = NM_BRIDGE_HELLO_TIME_DEF_SYS,
@@ -7256,6 +7777,23 @@ nm_platform_bridge_vlan_to_string(const NMPlatformBridgeVlan *vlan, char *buf, g
     return buf;
 }
 
+const char *
+nm_platform_bridge_port_to_string(const NMPlatformBridgePort *port, char *buf, gsize len)
+{
+    if (!nm_utils_to_string_buffer_init_null(port, &buf, &len))
+        return buf;
+
+    g_snprintf(buf,
+               len,
+               "priority %u"
+               " path_cost %u"
+               " hairpin_mode %d",
+               port->priority,
+               port->path_cost,
+               (int) port->hairpin_mode);
+    return buf;
+}
+
 void
 nm_platform_link_hash_update(const NMPlatformLink *obj, NMHashState *h)
 {
@@ -7317,6 +7855,75 @@ nm_platform_link_cmp(const NMPlatformLink *a, const NMPlatformLink *b)
     return 0;
 }
 
+void
+nm_platform_lnk_bond_hash_update(const NMPlatformLnkBond *obj, NMHashState *h)
+{
+    nm_hash_update_vals(h,
+                        obj->ad_actor_system,
+                        obj->primary,
+                        obj->arp_all_targets,
+                        obj->arp_interval,
+                        obj->arp_validate,
+                        obj->downdelay,
+                        obj->lp_interval,
+                        obj->miimon,
+                        obj->min_links,
+                        obj->packets_per_slave,
+                        obj->resend_igmp,
+                        obj->updelay,
+                        obj->ad_actor_sys_prio,
+                        obj->ad_user_port_key,
+                        obj->ad_select,
+                        obj->arp_ip_targets_num,
+                        obj->fail_over_mac,
+                        obj->lacp_rate,
+                        obj->mode,
+                        obj->num_grat_arp,
+                        obj->primary_reselect,
+                        obj->xmit_hash_policy,
+                        NM_HASH_COMBINE_BOOLS(guint8,
+                                              obj->all_slaves_active,
+                                              obj->tlb_dynamic_lb,
+                                              obj->use_carrier));
+    nm_hash_update(h, obj->arp_ip_target, obj->arp_ip_targets_num * sizeof(obj->arp_ip_target[0]));
+}
+
+int
+nm_platform_lnk_bond_cmp(const NMPlatformLnkBond *a, const NMPlatformLnkBond *b)
+{
+    NM_CMP_SELF(a, b);
+    NM_CMP_FIELD(a, b, mode);
+    NM_CMP_FIELD(a, b, primary);
+    NM_CMP_FIELD(a, b, miimon);
+    NM_CMP_FIELD(a, b, updelay);
+    NM_CMP_FIELD(a, b, downdelay);
+    NM_CMP_FIELD_BOOL(a, b, use_carrier);
+    NM_CMP_FIELD(a, b, arp_interval);
+    NM_CMP_FIELD(a, b, arp_ip_targets_num);
+    NM_CMP_FIELD_MEMCMP_LEN(a,
+                            b,
+                            arp_ip_target,
+                            a->arp_ip_targets_num * sizeof(a->arp_ip_target[0]));
+    NM_CMP_FIELD(a, b, arp_validate);
+    NM_CMP_FIELD(a, b, arp_all_targets);
+    NM_CMP_FIELD(a, b, primary_reselect);
+    NM_CMP_FIELD(a, b, fail_over_mac);
+    NM_CMP_FIELD(a, b, xmit_hash_policy);
+    NM_CMP_FIELD(a, b, resend_igmp);
+    NM_CMP_FIELD(a, b, num_grat_arp);
+    NM_CMP_FIELD_BOOL(a, b, all_slaves_active);
+    NM_CMP_FIELD(a, b, min_links);
+    NM_CMP_FIELD(a, b, lp_interval);
+    NM_CMP_FIELD(a, b, packets_per_slave);
+    NM_CMP_FIELD(a, b, lacp_rate);
+    NM_CMP_FIELD(a, b, ad_select);
+    NM_CMP_FIELD(a, b, ad_actor_sys_prio);
+    NM_CMP_FIELD(a, b, ad_user_port_key);
+    NM_CMP_FIELD_MEMCMP(a, b, ad_actor_system);
+    NM_CMP_FIELD_BOOL(a, b, tlb_dynamic_lb);
+    return 0;
+}
+
 void
 nm_platform_lnk_bridge_hash_update(const NMPlatformLnkBridge *obj, NMHashState *h)
 {
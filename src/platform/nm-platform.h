@@ -810,6 +810,43 @@ typedef struct {
     bool    pvid : 1;
 } NMPlatformBridgeVlan;
 
+typedef struct {
+    guint32 path_cost;
+    guint16 priority;
+    bool    hairpin_mode : 1;
+} NMPlatformBridgePort;
+
+#define NM_BOND_MAX_ARP_TARGETS 16
+
+typedef struct {
+    NMEtherAddr ad_actor_system;
+    in_addr_t   arp_ip_target[NM_BOND_MAX_ARP_TARGETS];
+    int         primary;
+    guint32     arp_all_targets;
+    guint32     arp_interval;
+    guint32     arp_validate;
+    guint32     downdelay;
+    guint32     lp_interval;
+    guint32     miimon;
+    guint32     min_links;
+    guint32     packets_per_slave;
+    guint32     resend_igmp;
+    guint32     updelay;
+    guint16     ad_actor_sys_prio;
+    guint16     ad_user_port_key;
+    guint8      ad_select;
+    guint8      arp_ip_targets_num;
+    guint8      fail_over_mac;
+    guint8      lacp_rate;
+    guint8      mode;
+    guint8      num_grat_arp;
+    guint8      primary_reselect;
+    guint8      xmit_hash_policy;
+    bool        all_slaves_active : 1;
+    bool        tlb_dynamic_lb : 1;
+    bool        use_carrier : 1;
+} NMPlatformLnkBond;
+
 typedef struct {
     NMEtherAddr group_addr;
     bool        mcast_querier : 1;
@@ -1010,6 +1047,50 @@ typedef void (*NMPlatformAsyncCallback)(GError *error, gpointer user_data);
 
 /*****************************************************************************/
 
+#define NM_PLATFORM_STATS_HISTOGRAM_N_BUCKETS 7
+
+typedef struct {
+    guint64 count;
+    guint64 sum_usec;
+    guint64 max_usec;
+
+    /* bucket i counts the durations below 10^(i+1) microseconds. The last
+     * bucket counts everything from 1 second on. */
+    guint64 buckets[NM_PLATFORM_STATS_HISTOGRAM_N_BUCKETS];
+} NMPlatformStatsHistogram;
+
+#define NM_PLATFORM_STATS_MSG_TYPES_N 128
+
+typedef struct {
+    /* the number of received netlink messages, by nlmsg_type. Types
+     * that don't fit into the array are counted in @msgs_other. */
+    guint64 msgs_by_type[NM_PLATFORM_STATS_MSG_TYPES_N];
+    guint64 msgs_other;
+
+    /* the number of received netlink messages per ifindex, as
+     * GINT_TO_POINTER(ifindex) -> GSIZE_TO_POINTER(count). Entries get
+     * dropped when the link goes away. */
+    GHashTable *msgs_by_ifindex;
+
+    /* time spent to parse a message into a NMPObject. */
+    NMPlatformStatsHistogram parse;
+
+    /* time spent to update the cache with the parsed object, including the
+     * emitted signals. */
+    NMPlatformStatsHistogram cache_update;
+
+    /* time from sending a request until the ACK or the error was received. */
+    NMPlatformStatsHistogram ack_wait;
+
+    /* how often the full content of the cache was requested from kernel. */
+    guint64 resyncs;
+
+    /* how often the netlink socket overflowed and we lost events. */
+    guint64 overflows;
+} NMPlatformStats;
+
+/*****************************************************************************/
+
 typedef enum {
     NM_PLATFORM_KERNEL_SUPPORT_TYPE_EXTENDED_IFA_FLAGS,
     NM_PLATFORM_KERNEL_SUPPORT_TYPE_USER_IPV6LL,
@@ -1091,6 +1172,8 @@ typedef struct {
     void (*refresh_all)(NMPlatform *self, NMPObjectType obj_type);
     void (*process_events)(NMPlatform *self);
 
+    const NMPlatformStats *(*get_stats)(NMPlatform *self);
+
     int (*link_add)(NMPlatform *           self,
                     NMLinkType             type,
                     const char *           name,
@@ -1130,6 +1213,20 @@ typedef struct {
                                       int                                ifindex,
                                       gboolean                           on_master,
                                       const NMPlatformBridgeVlan *const *vlans);
+    gboolean (*link_del_bridge_vlans)(NMPlatform *                       self,
+                                      int                                ifindex,
+                                      gboolean                           on_master,
+                                      const NMPlatformBridgeVlan *const *vlans);
+    GArray *(*link_get_bridge_vlans)(NMPlatform *self, int ifindex);
+
+    int (*ethtool_get_ring)(NMPlatform *self, int ifindex, struct _NMEthtoolRingState *ring);
+    int (*ethtool_set_ring)(NMPlatform *self, int ifindex, const struct _NMEthtoolRingState *ring);
+    int (*ethtool_get_coalesce)(NMPlatform *                    self,
+                                int                             ifindex,
+                                struct _NMEthtoolCoalesceState *coalesce);
+    int (*ethtool_set_coalesce)(NMPlatform *                          self,
+                                int                                   ifindex,
+                                const struct _NMEthtoolCoalesceState *coalesce);
 
     char *(*link_get_physical_port_id)(NMPlatform *self, int ifindex);
     guint (*link_get_dev_id)(NMPlatform *self, int ifindex);
@@ -1157,6 +1254,12 @@ typedef struct {
                                  guint                                     peers_len,
                                  NMPlatformWireGuardChangeFlags            change_flags);
 
+    int (*link_bond_change)(NMPlatform *self, int ifindex, const NMPlatformLnkBond *props);
+    int (*link_bridge_change)(NMPlatform *self, int ifindex, const NMPlatformLnkBridge *props);
+    gboolean (*link_set_bridge_port)(NMPlatform *                self,
+                                     int                         ifindex,
+                                     const NMPlatformBridgePort *props);
+
     gboolean (*link_vlan_change)(NMPlatform *            self,
                                  int                     ifindex,
                                  NMVlanFlags             flags_mask,
@@ -1831,6 +1934,9 @@ const char *nm_platform_link_get_type_name(NMPlatform *self, int ifindex);
 gboolean nm_platform_link_refresh(NMPlatform *self, int ifindex);
 void     nm_platform_process_events(NMPlatform *self);
 
+const NMPlatformStats *nm_platform_get_stats(NMPlatform *self);
+const char *           nm_platform_stats_msg_type_to_string(guint16 type, char *buf, gsize len);
+
 const NMPlatformLink *
 nm_platform_process_events_ensure_link(NMPlatform *self, int ifindex, const char *ifname);
 
@@ -1867,6 +1973,11 @@ gboolean nm_platform_link_set_bridge_vlans(NMPlatform *                       se
                                            int                                ifindex,
                                            gboolean                           on_master,
                                            const NMPlatformBridgeVlan *const *vlans);
+GArray * nm_platform_link_get_bridge_vlans(NMPlatform *self, int ifindex);
+gboolean nm_platform_link_sync_bridge_vlans(NMPlatform *                       self,
+                                            int                                ifindex,
+                                            gboolean                           on_master,
+                                            const NMPlatformBridgeVlan *const *vlans);
 
 char *   nm_platform_link_get_physical_port_id(NMPlatform *self, int ifindex);
 guint    nm_platform_link_get_dev_id(NMPlatform *self, int ifindex);
@@ -1899,6 +2010,8 @@ const NMPObject *nm_platform_link_get_lnk(NMPlatform *           self,
                                           int                    ifindex,
                                           NMLinkType             link_type,
                                           const NMPlatformLink **out_link);
+const NMPlatformLnkBond *
+nm_platform_link_get_lnk_bond(NMPlatform *self, int ifindex, const NMPlatformLink **out_link);
 const NMPlatformLnkBridge *
 nm_platform_link_get_lnk_bridge(NMPlatform *self, int ifindex, const NMPlatformLink **out_link);
 const NMPlatformLnkGre *
@@ -1936,6 +2049,13 @@ nm_platform_link_get_lnk_vxlan(NMPlatform *self, int ifindex, const NMPlatformLi
 const NMPlatformLnkWireGuard *
 nm_platform_link_get_lnk_wireguard(NMPlatform *self, int ifindex, const NMPlatformLink **out_link);
 
+int nm_platform_link_bond_change(NMPlatform *self, int ifindex, const NMPlatformLnkBond *props);
+int
+nm_platform_link_bridge_change(NMPlatform *self, int ifindex, const NMPlatformLnkBridge *props);
+gboolean nm_platform_link_set_bridge_port(NMPlatform *                self,
+                                          int                         ifindex,
+                                          const NMPlatformBridgePort *props);
+
 gboolean nm_platform_link_vlan_set_ingress_map(NMPlatform *self, int ifindex, int from, int to);
 gboolean nm_platform_link_vlan_set_egress_map(NMPlatform *self, int ifindex, int from, int to);
 gboolean nm_platform_link_vlan_change(NMPlatform *            self,
@@ -2186,6 +2306,7 @@ int nm_platform_tfilter_add(NMPlatform *self, NMPNlmFlags flags, const NMPlatfor
 gboolean nm_platform_tfilter_sync(NMPlatform *self, int ifindex, GPtrArray *known_tfilters);
 
 const char *nm_platform_link_to_string(const NMPlatformLink *link, char *buf, gsize len);
+const char *nm_platform_lnk_bond_to_string(const NMPlatformLnkBond *lnk, char *buf, gsize len);
 const char *nm_platform_lnk_bridge_to_string(const NMPlatformLnkBridge *lnk, char *buf, gsize len);
 const char *nm_platform_lnk_gre_to_string(const NMPlatformLnkGre *lnk, char *buf, gsize len);
 const char *
@@ -2215,6 +2336,8 @@ const char *nm_platform_tfilter_to_string(const NMPlatformTfilter *tfilter, char
 const char *nm_platform_vf_to_string(const NMPlatformVF *vf, char *buf, gsize len);
 const char *
 nm_platform_bridge_vlan_to_string(const NMPlatformBridgeVlan *vlan, char *buf, gsize len);
+const char *
+nm_platform_bridge_port_to_string(const NMPlatformBridgePort *port, char *buf, gsize len);
 
 const char *nm_platform_vlan_qos_mapping_to_string(const char *            name,
                                                    const NMVlanQosMapping *map,
@@ -2226,6 +2349,7 @@ const char *
 nm_platform_wireguard_peer_to_string(const struct _NMPWireGuardPeer *peer, char *buf, gsize len);
 
 int nm_platform_link_cmp(const NMPlatformLink *a, const NMPlatformLink *b);
+int nm_platform_lnk_bond_cmp(const NMPlatformLnkBond *a, const NMPlatformLnkBond *b);
 int nm_platform_lnk_bridge_cmp(const NMPlatformLnkBridge *a, const NMPlatformLnkBridge *b);
 int nm_platform_lnk_gre_cmp(const NMPlatformLnkGre *a, const NMPlatformLnkGre *b);
 int nm_platform_lnk_infiniband_cmp(const NMPlatformLnkInfiniband *a,
@@ -2299,6 +2423,7 @@ void nm_platform_ip6_route_hash_update(const NMPlatformIP6Route *obj,
 void nm_platform_routing_rule_hash_update(const NMPlatformRoutingRule *obj,
                                           NMPlatformRoutingRuleCmpType cmp_type,
                                           NMHashState *                h);
+void nm_platform_lnk_bond_hash_update(const NMPlatformLnkBond *obj, NMHashState *h);
 void nm_platform_lnk_bridge_hash_update(const NMPlatformLnkBridge *obj, NMHashState *h);
 void nm_platform_lnk_gre_hash_update(const NMPlatformLnkGre *obj, NMHashState *h);
 void nm_platform_lnk_infiniband_hash_update(const NMPlatformLnkInfiniband *obj, NMHashState *h);
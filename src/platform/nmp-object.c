@@ -418,6 +418,34 @@ _idx_obj_part(const DedupMultiIdxType *idx_type,
         }
         return 1;
 
+    case NMP_CACHE_ID_TYPE_ROUTES_BY_IFINDEX_TABLE:
+        obj_type = NMP_OBJECT_GET_TYPE(obj_a);
+        if (!NM_IN_SET(obj_type, NMP_OBJECT_TYPE_IP4_ROUTE, NMP_OBJECT_TYPE_IP6_ROUTE)
+            || !nmp_object_is_visible(obj_a)) {
+            if (h)
+                nm_hash_update_val(h, obj_a);
+            return 0;
+        }
+        nm_assert(NMP_OBJECT_CAST_IP_ROUTE(obj_a)->ifindex > 0);
+        if (obj_b) {
+            return obj_type == NMP_OBJECT_GET_TYPE(obj_b)
+                   && NMP_OBJECT_CAST_IP_ROUTE(obj_a)->ifindex
+                          == NMP_OBJECT_CAST_IP_ROUTE(obj_b)->ifindex
+                   && nm_platform_ip_route_get_effective_table(NMP_OBJECT_CAST_IP_ROUTE(obj_a))
+                          == nm_platform_ip_route_get_effective_table(
+                              NMP_OBJECT_CAST_IP_ROUTE(obj_b))
+                   && nmp_object_is_visible(obj_b);
+        }
+        if (h) {
+            nm_hash_update_vals(
+                h,
+                idx_type->cache_id_type,
+                obj_type,
+                NMP_OBJECT_CAST_IP_ROUTE(obj_a)->ifindex,
+                nm_platform_ip_route_get_effective_table(NMP_OBJECT_CAST_IP_ROUTE(obj_a)));
+        }
+        return 1;
+
     case NMP_CACHE_ID_TYPE_OBJECT_BY_ADDR_FAMILY:
         obj_type = NMP_OBJECT_GET_TYPE(obj_a);
         /* currently, only routing rules are supported for this cache-id-type. */
@@ -1781,6 +1809,7 @@ static const guint8 _supported_cache_ids_ipx_route[] = {
     NMP_CACHE_ID_TYPE_OBJECT_BY_IFINDEX,
     NMP_CACHE_ID_TYPE_DEFAULT_ROUTES,
     NMP_CACHE_ID_TYPE_ROUTES_BY_WEAK_ID,
+    NMP_CACHE_ID_TYPE_ROUTES_BY_IFINDEX_TABLE,
     0,
 };
 
@@ -2167,6 +2196,25 @@ nmp_lookup_init_route_by_weak_id(NMPLookup *lookup, const NMPObject *obj)
     }
 }
 
+const NMPLookup *
+nmp_lookup_init_route_by_ifindex_table(NMPLookup *   lookup,
+                                       NMPObjectType obj_type,
+                                       int           ifindex,
+                                       guint32       table)
+{
+    NMPObject *o;
+
+    nm_assert(lookup);
+    nm_assert(NM_IN_SET(obj_type, NMP_OBJECT_TYPE_IP4_ROUTE, NMP_OBJECT_TYPE_IP6_ROUTE));
+    nm_assert(ifindex > 0);
+
+    o                         = _nmp_object_stackinit_from_type(&lookup->selector_obj, obj_type);
+    o->ip_route.ifindex       = ifindex;
+    o->ip_route.table_coerced = nm_platform_route_table_coerce(table);
+    lookup->cache_id_type     = NMP_CACHE_ID_TYPE_ROUTES_BY_IFINDEX_TABLE;
+    return _L(lookup);
+}
+
 const NMPLookup *
 nmp_lookup_init_ip4_route_by_weak_id(NMPLookup *lookup,
                                      in_addr_t  network,
@@ -3239,6 +3287,18 @@ const NMPClass _nmp_classes[NMP_OBJECT_TYPE_MAX] = {
             .cmd_plobj_hash_update    = (CmdPlobjHashUpdateFunc) nm_platform_tfilter_hash_update,
             .cmd_plobj_cmp            = (CmdPlobjCmpFunc) nm_platform_tfilter_cmp,
         },
+    [NMP_OBJECT_TYPE_LNK_BOND - 1] =
+        {
+            .parent                = DEDUP_MULTI_OBJ_CLASS_INIT(),
+            .obj_type              = NMP_OBJECT_TYPE_LNK_BOND,
+            .sizeof_data           = sizeof(NMPObjectLnkBond),
+            .sizeof_public         = sizeof(NMPlatformLnkBond),
+            .obj_type_name         = "bond",
+            .lnk_link_type         = NM_LINK_TYPE_BOND,
+            .cmd_plobj_to_string   = (CmdPlobjToStringFunc) nm_platform_lnk_bond_to_string,
+            .cmd_plobj_hash_update = (CmdPlobjHashUpdateFunc) nm_platform_lnk_bond_hash_update,
+            .cmd_plobj_cmp         = (CmdPlobjCmpFunc) nm_platform_lnk_bond_cmp,
+        },
     [NMP_OBJECT_TYPE_LNK_BRIDGE - 1] =
         {
             .parent                = DEDUP_MULTI_OBJ_CLASS_INIT(),
@@ -155,6 +155,11 @@ typedef enum { /*< skip >*/
      * cache-resync. */
                NMP_CACHE_ID_TYPE_ROUTES_BY_WEAK_ID,
 
+               /* the visible routes of an ifindex, partitioned by their (effective) route table.
+     * This allows to look at the routes of one table only, without visiting
+     * all the routes of the interface. */
+               NMP_CACHE_ID_TYPE_ROUTES_BY_IFINDEX_TABLE,
+
                /* a filter for objects that track an explicit address family.
      *
      * Note that currently on NMPObjectRoutingRule is indexed by this filter. */
@@ -241,6 +246,10 @@ typedef struct {
     int wireguard_family_id;
 } NMPObjectLink;
 
+typedef struct {
+    NMPlatformLnkBond _public;
+} NMPObjectLnkBond;
+
 typedef struct {
     NMPlatformLnkBridge _public;
 } NMPObjectLnkBridge;
@@ -345,6 +354,9 @@ struct _NMPObject {
         NMPlatformLink link;
         NMPObjectLink  _link;
 
+        NMPlatformLnkBond lnk_bond;
+        NMPObjectLnkBond  _lnk_bond;
+
         NMPlatformLnkBridge lnk_bridge;
         NMPObjectLnkBridge  _lnk_bridge;
 
@@ -488,6 +500,7 @@ _NMP_OBJECT_TYPE_IS_OBJ_WITH_IFINDEX(NMPObjectType obj_type)
 
     case NMP_OBJECT_TYPE_TFILTER:
 
+    case NMP_OBJECT_TYPE_LNK_BOND:
     case NMP_OBJECT_TYPE_LNK_BRIDGE:
     case NMP_OBJECT_TYPE_LNK_GRE:
     case NMP_OBJECT_TYPE_LNK_GRETAP:
@@ -564,6 +577,7 @@ _NMP_OBJECT_TYPE_IS_OBJ_WITH_IFINDEX(NMPObjectType obj_type)
 #define NMP_OBJECT_CAST_TFILTER(obj) _NMP_OBJECT_CAST(obj, tfilter, NMP_OBJECT_TYPE_TFILTER)
 #define NMP_OBJECT_CAST_LNK_WIREGUARD(obj) \
     _NMP_OBJECT_CAST(obj, lnk_wireguard, NMP_OBJECT_TYPE_LNK_WIREGUARD)
+#define NMP_OBJECT_CAST_LNK_BOND(obj) _NMP_OBJECT_CAST(obj, lnk_bond, NMP_OBJECT_TYPE_LNK_BOND)
 #define NMP_OBJECT_CAST_LNK_BRIDGE(obj) \
     _NMP_OBJECT_CAST(obj, lnk_bridge, NMP_OBJECT_TYPE_LNK_BRIDGE)
 
@@ -743,6 +757,10 @@ const NMPLookup *nmp_lookup_init_link_by_ifname(NMPLookup *lookup, const char *i
 const NMPLookup *nmp_lookup_init_object(NMPLookup *lookup, NMPObjectType obj_type, int ifindex);
 const NMPLookup *nmp_lookup_init_route_default(NMPLookup *lookup, NMPObjectType obj_type);
 const NMPLookup *nmp_lookup_init_route_by_weak_id(NMPLookup *lookup, const NMPObject *obj);
+const NMPLookup *nmp_lookup_init_route_by_ifindex_table(NMPLookup *   lookup,
+                                                        NMPObjectType obj_type,
+                                                        int           ifindex,
+                                                        guint32       table);
 const NMPLookup *nmp_lookup_init_ip4_route_by_weak_id(NMPLookup *lookup,
                                                       in_addr_t  network,
                                                       guint      plen,
@@ -10,6 +10,7 @@
 #include <sys/stat.h>
 #include <sys/types.h>
 #include <linux/if_tun.h>
+#include <linux/rtnetlink.h>
 
 #include "nm-glib-aux/nm-io-utils.h"
 #include "platform/nmp-object.h"
@@ -629,6 +630,202 @@ test_bridge_addr(void)
 
 /*****************************************************************************/
 
+static void
+test_bond_change(void)
+{
+    const NMPlatformLnkBond *lnk;
+    NMPlatformLnkBond        props;
+    int                      ifindex;
+
+    if (!g_file_test("/proc/1/net/bonding", G_FILE_TEST_IS_DIR)
+        && _system("modprobe --show bonding") != 0) {
+        g_test_skip("Skipping test for bonding: bonding module not available");
+        return;
+    }
+
+    nmtstp_run_command_check("ip link add %s type bond", DEVICE_NAME);
+    ifindex =
+        nmtstp_assert_wait_for_link(NM_PLATFORM_GET, DEVICE_NAME, NM_LINK_TYPE_BOND, 100)->ifindex;
+
+    lnk = nm_platform_link_get_lnk_bond(NM_PLATFORM_GET, ifindex, NULL);
+    g_assert(lnk);
+    props = *lnk;
+
+    /* Changing nothing must succeed without a request. */
+    g_assert(NMTST_NM_ERR_SUCCESS(nm_platform_link_bond_change(NM_PLATFORM_GET, ifindex, &props)));
+
+    props.mode      = 1; /* active-backup */
+    props.miimon    = 100;
+    props.updelay   = 200;
+    props.downdelay = 300;
+    g_assert(NMTST_NM_ERR_SUCCESS(nm_platform_link_bond_change(NM_PLATFORM_GET, ifindex, &props)));
+
+    lnk = nm_platform_link_get_lnk_bond(NM_PLATFORM_GET, ifindex, NULL);
+    g_assert(lnk);
+    g_assert_cmpint(lnk->mode, ==, 1);
+    g_assert_cmpint(lnk->miimon, ==, 100);
+    g_assert_cmpint(lnk->updelay, ==, 200);
+    g_assert_cmpint(lnk->downdelay, ==, 300);
+
+    props.miimon             = 0;
+    props.arp_interval       = 1000;
+    props.arp_ip_targets_num = 2;
+    props.arp_ip_target[0]   = nmtst_inet4_from_string("192.0.2.1");
+    props.arp_ip_target[1]   = nmtst_inet4_from_string("192.0.2.2");
+    g_assert(NMTST_NM_ERR_SUCCESS(nm_platform_link_bond_change(NM_PLATFORM_GET, ifindex, &props)));
+
+    lnk = nm_platform_link_get_lnk_bond(NM_PLATFORM_GET, ifindex, NULL);
+    g_assert(lnk);
+    g_assert_cmpint(lnk->miimon, ==, 0);
+    g_assert_cmpint(lnk->arp_interval, ==, 1000);
+    g_assert_cmpint(lnk->arp_ip_targets_num, ==, 2);
+    g_assert_cmpint(lnk->arp_ip_target[0], ==, nmtst_inet4_from_string("192.0.2.1"));
+    g_assert_cmpint(lnk->arp_ip_target[1], ==, nmtst_inet4_from_string("192.0.2.2"));
+
+    nmtstp_link_delete(NULL, -1, ifindex, DEVICE_NAME, TRUE);
+}
+
+static void
+test_bridge_change(void)
+{
+    const NMPlatformLnkBridge *lnk;
+    NMPlatformLnkBridge        props;
+    const NMPlatformLink *     plink = NULL;
+    int                        ifindex;
+
+    g_assert(NMTST_NM_ERR_SUCCESS(nm_platform_link_bridge_add(NM_PLATFORM_GET,
+                                                              DEVICE_NAME,
+                                                              NULL,
+                                                              0,
+                                                              0,
+                                                              &nm_platform_lnk_bridge_default,
+                                                              &plink)));
+    g_assert(plink);
+    ifindex = plink->ifindex;
+
+    lnk = nm_platform_link_get_lnk_bridge(NM_PLATFORM_GET, ifindex, NULL);
+    g_assert(lnk);
+    props = *lnk;
+
+    props.hello_time     = 300;
+    props.priority       = 4096;
+    props.mcast_hash_max = 1024;
+    props.mcast_snooping = !lnk->mcast_snooping;
+    g_assert(
+        NMTST_NM_ERR_SUCCESS(nm_platform_link_bridge_change(NM_PLATFORM_GET, ifindex, &props)));
+
+    lnk = nm_platform_link_get_lnk_bridge(NM_PLATFORM_GET, ifindex, NULL);
+    g_assert(lnk);
+    g_assert_cmpint(lnk->hello_time, ==, 300);
+    g_assert_cmpint(lnk->priority, ==, 4096);
+    g_assert_cmpint(lnk->mcast_hash_max, ==, 1024);
+    g_assert_cmpint(lnk->mcast_snooping, ==, props.mcast_snooping);
+    g_assert(nm_platform_lnk_bridge_cmp(lnk, &props) == 0);
+
+    nmtstp_link_delete(NULL, -1, ifindex, DEVICE_NAME, TRUE);
+}
+
+static void
+_assert_bridge_vlan(GArray *vlans, guint idx, guint16 vid_start, guint16 vid_end, gboolean pvid)
+{
+    const NMPlatformBridgeVlan *vlan;
+
+    g_assert(vlans);
+    g_assert_cmpint(idx, <, vlans->len);
+    vlan = &g_array_index(vlans, NMPlatformBridgeVlan, idx);
+    g_assert_cmpint(vlan->vid_start, ==, vid_start);
+    g_assert_cmpint(vlan->vid_end, ==, vid_end);
+    g_assert_cmpint(vlan->pvid, ==, pvid);
+}
+
+static void
+test_bridge_vlans_sync(void)
+{
+    const NMPlatformBridgeVlan vlan_pvid   = {.vid_start = 1, .vid_end = 1, .pvid = TRUE};
+    const NMPlatformBridgeVlan vlan_range  = {.vid_start = 10, .vid_end = 20};
+    const NMPlatformBridgeVlan vlan_range2 = {.vid_start = 15, .vid_end = 30};
+    const NMPlatformBridgeVlan vlan_pvid2  = {.vid_start = 17, .vid_end = 17, .pvid = TRUE};
+    const NMPlatformBridgeVlan *const list1[] = {&vlan_pvid, &vlan_range, NULL};
+    const NMPlatformBridgeVlan *const list2[] = {&vlan_pvid, &vlan_range2, &vlan_pvid2, NULL};
+    const NMPlatformLink *            plink   = NULL;
+    gs_unref_array GArray *vlans              = NULL;
+    int                               ifindex;
+
+    g_assert(NMTST_NM_ERR_SUCCESS(nm_platform_link_bridge_add(NM_PLATFORM_GET,
+                                                              DEVICE_NAME,
+                                                              NULL,
+                                                              0,
+                                                              0,
+                                                              &nm_platform_lnk_bridge_default,
+                                                              &plink)));
+    g_assert(plink);
+    ifindex = plink->ifindex;
+
+    g_assert(nm_platform_link_sync_bridge_vlans(NM_PLATFORM_GET, ifindex, FALSE, list1));
+    vlans = nm_platform_link_get_bridge_vlans(NM_PLATFORM_GET, ifindex);
+    g_assert(vlans);
+    g_assert_cmpint(vlans->len, ==, 2);
+    _assert_bridge_vlan(vlans, 0, 1, 1, TRUE);
+    _assert_bridge_vlan(vlans, 1, 10, 20, FALSE);
+    nm_clear_pointer(&vlans, g_array_unref);
+
+    /* The PVID moves to VLAN 17, which must split the range. */
+    g_assert(nm_platform_link_sync_bridge_vlans(NM_PLATFORM_GET, ifindex, FALSE, list2));
+    vlans = nm_platform_link_get_bridge_vlans(NM_PLATFORM_GET, ifindex);
+    g_assert(vlans);
+    g_assert_cmpint(vlans->len, ==, 4);
+    _assert_bridge_vlan(vlans, 0, 1, 1, FALSE);
+    _assert_bridge_vlan(vlans, 1, 15, 16, FALSE);
+    _assert_bridge_vlan(vlans, 2, 17, 17, TRUE);
+    _assert_bridge_vlan(vlans, 3, 18, 30, FALSE);
+    nm_clear_pointer(&vlans, g_array_unref);
+
+    g_assert(nm_platform_link_sync_bridge_vlans(NM_PLATFORM_GET, ifindex, FALSE, NULL));
+    vlans = nm_platform_link_get_bridge_vlans(NM_PLATFORM_GET, ifindex);
+    g_assert(vlans);
+    g_assert_cmpint(vlans->len, ==, 0);
+
+    nmtstp_link_delete(NULL, -1, ifindex, DEVICE_NAME, TRUE);
+}
+
+/*****************************************************************************/
+
+static void
+test_platform_stats(void)
+{
+    const NMPlatformStats *stats;
+    const NMPlatformLink * link;
+    guint64                n_newlink;
+    guint64                n_parse;
+    guint64                n_ack_wait;
+
+    stats = nm_platform_get_stats(NM_PLATFORM_GET);
+    if (!stats) {
+        g_test_skip("platform does not track statistics");
+        return;
+    }
+
+    /* filling the cache requested the full state from kernel. */
+    g_assert_cmpint(stats->resyncs, >, 0);
+
+    n_newlink  = stats->msgs_by_type[RTM_NEWLINK];
+    n_parse    = stats->parse.count;
+    n_ack_wait = stats->ack_wait.count;
+
+    link = nmtstp_link_dummy_add(NM_PLATFORM_GET, FALSE, "nm-stats0");
+
+    g_assert_cmpint(stats->msgs_by_type[RTM_NEWLINK], >, n_newlink);
+    g_assert_cmpint(stats->parse.count, >, n_parse);
+    g_assert_cmpint(stats->cache_update.count, <=, stats->parse.count);
+    g_assert_cmpint(stats->ack_wait.count, >, n_ack_wait);
+    g_assert(stats->msgs_by_ifindex);
+    g_assert(g_hash_table_lookup(stats->msgs_by_ifindex, GINT_TO_POINTER(link->ifindex)));
+
+    nmtstp_link_delete(NM_PLATFORM_GET, -1, link->ifindex, "nm-stats0", TRUE);
+}
+
+/*****************************************************************************/
+
 static void
 test_internal(void)
 {
@@ -3719,6 +3916,89 @@ test_ethtool_features_get(void)
 
 /*****************************************************************************/
 
+static void
+test_ethtool_ring_coalesce(void)
+{
+    const char *           IFACE_VETH0 = "nm-test-veth0";
+    const char *           IFACE_VETH1 = "nm-test-veth1";
+    const guint            IDX_RX_USECS =
+        _NM_ETHTOOL_ID_COALESCE_AS_IDX(NM_ETHTOOL_ID_COALESCE_RX_USECS);
+    int                    ifindex;
+    NMEthtoolRingState     ring;
+    NMEthtoolRingState     ring_ioctl;
+    NMEthtoolRingState     ring_new;
+    NMEthtoolCoalesceState coalesce;
+    NMEthtoolCoalesceState coalesce_ioctl;
+    NMEthtoolCoalesceState coalesce_new;
+    gboolean               has_ring;
+    gboolean               has_coalesce;
+
+    ifindex = nmtstp_link_veth_add(NM_PLATFORM_GET, -1, IFACE_VETH0, IFACE_VETH1)->ifindex;
+
+    /* the platform prefers ethtool netlink and falls back to ioctl. Both must
+     * agree, also about whether the driver supports the settings at all. */
+    has_ring = nmp_utils_ethtool_get_ring(ifindex, &ring_ioctl);
+    g_assert_cmpint(has_ring,
+                    ==,
+                    nm_platform_ethtool_get_link_ring(NM_PLATFORM_GET, ifindex, &ring));
+    if (has_ring) {
+        g_assert_cmpmem(&ring, sizeof(ring), &ring_ioctl, sizeof(ring_ioctl));
+
+        /* setting the current values is a no-op. */
+        g_assert(nm_platform_ethtool_set_ring(NM_PLATFORM_GET, ifindex, &ring));
+
+        if (ring.rx_pending > 1) {
+            ring_new = ring;
+            ring_new.rx_pending--;
+            g_assert(nm_platform_ethtool_set_ring(NM_PLATFORM_GET, ifindex, &ring_new));
+            g_assert(nmp_utils_ethtool_get_ring(ifindex, &ring_ioctl));
+            g_assert_cmpmem(&ring_new, sizeof(ring_new), &ring_ioctl, sizeof(ring_ioctl));
+            g_assert(nm_platform_ethtool_get_link_ring(NM_PLATFORM_GET, ifindex, &ring_new));
+            g_assert_cmpmem(&ring_new, sizeof(ring_new), &ring_ioctl, sizeof(ring_ioctl));
+
+            g_assert(nm_platform_ethtool_set_ring(NM_PLATFORM_GET, ifindex, &ring));
+            g_assert(nmp_utils_ethtool_get_ring(ifindex, &ring_ioctl));
+            g_assert_cmpmem(&ring, sizeof(ring), &ring_ioctl, sizeof(ring_ioctl));
+        }
+    } else {
+        ring_new = (NMEthtoolRingState){};
+        g_assert(!nm_platform_ethtool_set_ring(NM_PLATFORM_GET, ifindex, &ring_new));
+    }
+
+    has_coalesce = nmp_utils_ethtool_get_coalesce(ifindex, &coalesce_ioctl);
+    g_assert_cmpint(has_coalesce,
+                    ==,
+                    nm_platform_ethtool_get_link_coalesce(NM_PLATFORM_GET, ifindex, &coalesce));
+    if (has_coalesce) {
+        g_assert_cmpmem(&coalesce, sizeof(coalesce), &coalesce_ioctl, sizeof(coalesce_ioctl));
+
+        g_assert(nm_platform_ethtool_set_coalesce(NM_PLATFORM_GET, ifindex, &coalesce));
+
+        /* the driver may not support rx-usecs. Then both paths fail. */
+        coalesce_new = coalesce;
+        coalesce_new.s[IDX_RX_USECS]++;
+        if (nm_platform_ethtool_set_coalesce(NM_PLATFORM_GET, ifindex, &coalesce_new)) {
+            g_assert(nmp_utils_ethtool_get_coalesce(ifindex, &coalesce_ioctl));
+            g_assert_cmpmem(&coalesce_new,
+                            sizeof(coalesce_new),
+                            &coalesce_ioctl,
+                            sizeof(coalesce_ioctl));
+            g_assert(nm_platform_ethtool_set_coalesce(NM_PLATFORM_GET, ifindex, &coalesce));
+        } else
+            g_assert(!nmp_utils_ethtool_set_coalesce(ifindex, &coalesce_new));
+
+        g_assert(nmp_utils_ethtool_get_coalesce(ifindex, &coalesce_ioctl));
+        g_assert_cmpmem(&coalesce, sizeof(coalesce), &coalesce_ioctl, sizeof(coalesce_ioctl));
+    }
+
+    if (!has_ring && !has_coalesce)
+        g_test_skip("veth does not support ring and coalesce settings");
+
+    nmtstp_link_delete(NULL, -1, ifindex, IFACE_VETH0, TRUE);
+}
+
+/*****************************************************************************/
+
 NMTstpSetupFunc const _nmtstp_setup_platform_func = SETUP;
 
 void
@@ -3745,6 +4025,7 @@ _nmtstp_setup_tests(void)
     g_test_add_func("/link/software/team", test_team);
     g_test_add_func("/link/software/vlan", test_vlan);
     g_test_add_func("/link/software/bridge/addr", test_bridge_addr);
+    g_test_add_func("/link/platform-stats", test_platform_stats);
 
     if (nmtstp_is_root_test()) {
         g_test_add_func("/link/external", test_external);
@@ -3770,6 +4051,9 @@ _nmtstp_setup_tests(void)
         test_software_detect_add("/link/software/detect/wireguard/2", NM_LINK_TYPE_WIREGUARD, 2);
 
         g_test_add_func("/link/software/vlan/set-xgress", test_vlan_set_xgress);
+        g_test_add_func("/link/software/bond/change", test_bond_change);
+        g_test_add_func("/link/software/bridge/change", test_bridge_change);
+        g_test_add_func("/link/software/bridge/vlans-sync", test_bridge_vlans_sync);
 
         g_test_add_data_func("/link/create-many-links/20",
                              GUINT_TO_POINTER(20),
@@ -3815,5 +4099,6 @@ _nmtstp_setup_tests(void)
         g_test_add_func("/general/sysctl/set-async-fail", test_sysctl_set_async_fail);
 
         g_test_add_func("/link/ethtool/features/get", test_ethtool_features_get);
+        g_test_add_func("/link/ethtool/ring-coalesce", test_ethtool_ring_coalesce);
     }
 }
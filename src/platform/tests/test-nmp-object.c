@@ -559,6 +559,69 @@ test_cache_qdisc(void)
 
 /*****************************************************************************/
 
+static void
+test_cache_route_table(void)
+{
+    NMPCache *                      cache;
+    nm_auto_unref_dedup_multi_index NMDedupMultiIndex *multi_idx = NULL;
+    NMPLookup                                          lookup;
+    const NMDedupMultiHeadEntry *                      head_entry;
+    guint                                              i;
+
+    multi_idx = nm_dedup_multi_index_new();
+    cache     = nmp_cache_new(multi_idx, nmtst_get_rand_uint32() % 2);
+
+    for (i = 0; i < 30; i++) {
+        const NMPlatformIP4Route r = {
+            .ifindex       = 1 + (i % 2),
+            .network       = nmtst_inet4_from_string("192.168.0.0") + htonl(i << 8),
+            .plen          = 24,
+            .metric        = 100,
+            .table_coerced = nm_platform_route_table_coerce(i % 3 == 0 ? 0u : 100u + (i % 3)),
+            .rt_source     = NM_IP_CONFIG_SOURCE_RTPROT_KERNEL,
+        };
+        nm_auto_nmpobj NMPObject *obj =
+            nmp_object_new(NMP_OBJECT_TYPE_IP4_ROUTE, (NMPlatformObject *) &r);
+
+        g_assert(nmp_cache_update_netlink(cache, obj, FALSE, NULL, NULL) == NMP_CACHE_OPS_ADDED);
+    }
+
+    head_entry =
+        nmp_cache_lookup(cache, nmp_lookup_init_object(&lookup, NMP_OBJECT_TYPE_IP4_ROUTE, 1));
+    g_assert_cmpint(head_entry->len, ==, 15);
+
+    /* table 0 and RT_TABLE_MAIN are the same partition. */
+    head_entry = nmp_cache_lookup(
+        cache,
+        nmp_lookup_init_route_by_ifindex_table(&lookup, NMP_OBJECT_TYPE_IP4_ROUTE, 1, 0));
+    g_assert_cmpint(head_entry->len, ==, 5);
+    head_entry = nmp_cache_lookup(cache,
+                                  nmp_lookup_init_route_by_ifindex_table(&lookup,
+                                                                         NMP_OBJECT_TYPE_IP4_ROUTE,
+                                                                         1,
+                                                                         RT_TABLE_MAIN));
+    g_assert_cmpint(head_entry->len, ==, 5);
+
+    head_entry = nmp_cache_lookup(
+        cache,
+        nmp_lookup_init_route_by_ifindex_table(&lookup, NMP_OBJECT_TYPE_IP4_ROUTE, 2, 101));
+    g_assert_cmpint(head_entry->len, ==, 5);
+
+    head_entry = nmp_cache_lookup(
+        cache,
+        nmp_lookup_init_route_by_ifindex_table(&lookup, NMP_OBJECT_TYPE_IP4_ROUTE, 1, 200));
+    g_assert(!head_entry);
+
+    head_entry = nmp_cache_lookup(
+        cache,
+        nmp_lookup_init_route_by_ifindex_table(&lookup, NMP_OBJECT_TYPE_IP6_ROUTE, 1, 0));
+    g_assert(!head_entry);
+
+    nmp_cache_free(cache);
+}
+
+/*****************************************************************************/
+
 NMTST_DEFINE();
 
 int
@@ -603,6 +666,7 @@ main(int argc, char **argv)
     g_test_add_func("/nmp-object/obj-base", test_obj_base);
     g_test_add_func("/nmp-object/cache_link", test_cache_link);
     g_test_add_func("/nmp-object/cache_qdisc", test_cache_qdisc);
+    g_test_add_func("/nmp-object/cache_route_table", test_cache_route_table);
 
     result = g_test_run();
 
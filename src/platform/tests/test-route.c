@@ -541,6 +541,100 @@ test_ip6_route(void)
     free_signal(route_removed);
 }
 
+static GPtrArray *
+_ip6_route_sync_routes(int ifindex, guint n, guint32 mtu)
+{
+    GPtrArray *routes;
+    guint      i;
+
+    routes = g_ptr_array_new_with_free_func((GDestroyNotify) nmp_object_unref);
+    for (i = 0; i < n; i++) {
+        NMPlatformIP6Route rt = {
+            .ifindex   = ifindex,
+            .rt_source = NM_IP_CONFIG_SOURCE_USER,
+            .plen      = 128,
+            .metric    = 22987,
+            .mtu       = mtu,
+        };
+
+        inet_pton(AF_INET6, "2001:db8:e::", &rt.network);
+        rt.network.s6_addr[15] = i + 1;
+        g_ptr_array_add(routes,
+                        nmp_object_new(NMP_OBJECT_TYPE_IP6_ROUTE, (const NMPlatformObject *) &rt));
+    }
+    return routes;
+}
+
+static void
+test_ip6_route_sync_replace(void)
+{
+    const guint N             = 5;
+    int         ifindex       = nm_platform_link_get_ifindex(NM_PLATFORM_GET, DEVICE_NAME);
+    SignalData *route_added   = add_signal(NM_PLATFORM_SIGNAL_IP6_ROUTE_CHANGED,
+                                         NM_PLATFORM_SIGNAL_ADDED,
+                                         ip6_route_callback);
+    SignalData *route_changed = add_signal(NM_PLATFORM_SIGNAL_IP6_ROUTE_CHANGED,
+                                           NM_PLATFORM_SIGNAL_CHANGED,
+                                           ip6_route_callback);
+    SignalData *route_removed = add_signal(NM_PLATFORM_SIGNAL_IP6_ROUTE_CHANGED,
+                                           NM_PLATFORM_SIGNAL_REMOVED,
+                                           ip6_route_callback);
+    gs_unref_ptrarray GPtrArray *routes1 = NULL;
+    gs_unref_ptrarray GPtrArray *routes2 = NULL;
+    const NMPlatformStats *      stats;
+    guint64                      n_newroute = 0;
+    guint64                      n_delroute = 0;
+    guint                        i;
+
+    stats = nm_platform_get_stats(NM_PLATFORM_GET);
+
+    routes1 = _ip6_route_sync_routes(ifindex, N, 1400);
+    g_assert(nm_platform_ip_route_sync(NM_PLATFORM_GET, AF_INET6, ifindex, routes1, NULL, NULL));
+    accept_signals(route_added, N, N);
+    ensure_no_signal(route_changed);
+    ensure_no_signal(route_removed);
+
+    /* Only the MTU differs. That doesn't change the identity of the IPv6 routes, so
+     * they are updated in place with NLM_F_REPLACE. They never disappear, hence
+     * there is one change notification per route and no removal. */
+    routes2 = _ip6_route_sync_routes(ifindex, N, 1500);
+    if (stats) {
+        n_newroute = stats->msgs_by_type[RTM_NEWROUTE];
+        n_delroute = stats->msgs_by_type[RTM_DELROUTE];
+    }
+    g_assert(nm_platform_ip_route_sync(NM_PLATFORM_GET, AF_INET6, ifindex, routes2, NULL, NULL));
+    accept_signals(route_changed, N, N);
+    ensure_no_signal(route_added);
+    ensure_no_signal(route_removed);
+
+    /* kernel notifies about a deleted route with RTM_DELROUTE. With NLM_F_REPLACE,
+     * there is only one RTM_NEWROUTE per route. */
+    if (stats) {
+        g_assert_cmpint(stats->msgs_by_type[RTM_DELROUTE], ==, n_delroute);
+        g_assert_cmpint(stats->msgs_by_type[RTM_NEWROUTE], >=, n_newroute + N);
+    }
+
+    for (i = 0; i < N; i++) {
+        const NMPObject *o;
+
+        o = nm_platform_lookup_obj(NM_PLATFORM_GET,
+                                   NMP_CACHE_ID_TYPE_OBJECT_TYPE,
+                                   routes2->pdata[i]);
+        g_assert(o);
+        g_assert_cmpint(NMP_OBJECT_CAST_IP6_ROUTE(o)->mtu, ==, 1500);
+    }
+
+    /* syncing again is a no-op. */
+    g_assert(nm_platform_ip_route_sync(NM_PLATFORM_GET, AF_INET6, ifindex, routes2, NULL, NULL));
+    ensure_no_signal(route_added);
+    ensure_no_signal(route_changed);
+    ensure_no_signal(route_removed);
+
+    free_signal(route_added);
+    free_signal(route_changed);
+    free_signal(route_removed);
+}
+
 /*****************************************************************************/
 
 static void
@@ -1915,6 +2009,7 @@ _nmtstp_setup_tests(void)
         add_test_func("/route/ip4_route_get", test_ip4_route_get);
         add_test_func("/route/ip6_route_get", test_ip6_route_get);
         add_test_func("/route/ip4_zero_gateway", test_ip4_zero_gateway);
+        add_test_func("/route/ip6_sync_replace", test_ip6_route_sync_replace);
     }
 
     if (nmtstp_is_root_test()) {
@@ -100,6 +100,11 @@ typedef struct _NMSettingsConnectionPrivate {
      */
     GVariant *agent_secrets;
 
+    /* The secret-free settings as returned by GetSettings(), including
+     * timestamp and seen-bssids. Built lazily and dropped whenever any
+     * of them changes, so that repeated requests only take a reference. */
+    GVariant *getsettings_cached;
+
     GHashTable *seen_bssids; /* Up-to-date BSSIDs that's been seen for the connection */
 
     guint64 timestamp; /* Up-to-date timestamp of connection use */
@@ -287,6 +292,8 @@ _nm_settings_connection_set_connection(NMSettingsConnection *           self,
         priv->connection = g_object_ref(new_connection);
         nmtst_connection_assert_unchanging(priv->connection);
 
+        nm_clear_pointer(&priv->getsettings_cached, g_variant_unref);
+
         /* note that we only return @connection_old if the new connection actually differs from
          * before.
          *
@@ -1325,6 +1332,7 @@ get_settings_auth_cb(NMSettingsConnection * self,
                      GError *               error,
                      gpointer               data)
 {
+    NMSettingsConnectionPrivate *    priv        = NM_SETTINGS_CONNECTION_GET_PRIVATE(self);
     gs_free const char **            seen_bssids = NULL;
     NMConnectionSerializationOptions options     = {};
     GVariant *                       settings;
@@ -1334,6 +1342,13 @@ get_settings_auth_cb(NMSettingsConnection * self,
         return;
     }
 
+    if (priv->getsettings_cached) {
+        g_dbus_method_invocation_return_value(
+            context,
+            g_variant_new("(@a{sa{sv}})", priv->getsettings_cached));
+        return;
+    }
+
     /* Timestamp is not updated in connection's 'timestamp' property,
      * because it would force updating the connection and in turn
      * writing to /etc periodically, which we want to avoid. Rather real
@@ -1357,6 +1372,8 @@ get_settings_auth_cb(NMSettingsConnection * self,
     settings = nm_connection_to_dbus_full(nm_settings_connection_get_connection(self),
                                           NM_CONNECTION_SERIALIZE_NO_SECRETS,
                                           &options);
+    priv->getsettings_cached = g_variant_ref_sink(settings);
+
     g_dbus_method_invocation_return_value(context, g_variant_new("(@a{sa{sv}})", settings));
 }
 
@@ -2241,6 +2258,8 @@ nm_settings_connection_update_timestamp(NMSettingsConnection *self, guint64 time
     priv->timestamp     = timestamp;
     priv->timestamp_set = TRUE;
 
+    nm_clear_pointer(&priv->getsettings_cached, g_variant_unref);
+
     _LOGT("timestamp: set timestamp %" G_GUINT64_FORMAT, timestamp);
 
     if (!priv->kf_db_timestamps)
@@ -2270,6 +2289,8 @@ _nm_settings_connection_register_kf_dbs(NMSettingsConnection *self,
 
     connection_uuid = nm_settings_connection_get_uuid(self);
 
+    nm_clear_pointer(&priv->getsettings_cached, g_variant_unref);
+
     if (priv->kf_db_timestamps != kf_db_timestamps) {
         gs_free char *tmp_str = NULL;
         guint64       timestamp;
@@ -2398,7 +2419,8 @@ nm_settings_connection_add_seen_bssid(NMSettingsConnection *self, const char *se
     if (!priv->seen_bssids)
         priv->seen_bssids = _seen_bssids_hash_new();
 
-    g_hash_table_add(priv->seen_bssids, g_strdup(seen_bssid));
+    if (g_hash_table_add(priv->seen_bssids, g_strdup(seen_bssid)))
+        nm_clear_pointer(&priv->getsettings_cached, g_variant_unref);
 
     if (!priv->kf_db_seen_bssids)
         return;
@@ -2661,6 +2683,7 @@ dispose(GObject *object)
 
     nm_clear_pointer(&priv->system_secrets, g_variant_unref);
     nm_clear_pointer(&priv->agent_secrets, g_variant_unref);
+    nm_clear_pointer(&priv->getsettings_cached, g_variant_unref);
 
     nm_clear_pointer(&priv->seen_bssids, g_hash_table_destroy);
 
@@ -760,7 +760,7 @@ _bss_info_get_all_cb(GVariant *result, GError *error, gpointer user_data)
 }
 
 static void
-_bss_info_add(NMSupplicantInterface *self, const char *object_path)
+_bss_info_add(NMSupplicantInterface *self, const char *object_path, GVariant *properties)
 {
     NMSupplicantInterfacePrivate *priv       = NM_SUPPLICANT_INTERFACE_GET_PRIVATE(self);
     nm_auto_ref_string NMRefString *bss_path = NULL;
@@ -776,6 +776,22 @@ _bss_info_add(NMSupplicantInterface *self, const char *object_path)
         return;
     }
 
+    if (properties && g_variant_n_children(properties) > 0) {
+        /* The BSSAdded signal already carries all properties of the BSS. There is
+         * no need for a GetAll call. This matters when a scan finds hundreds of
+         * BSSs, as each GetAll is a D-Bus round trip. */
+        bss_info  = g_slice_new(NMSupplicantBssInfo);
+        *bss_info = (NMSupplicantBssInfo){
+            ._self    = self,
+            .bss_path = g_steal_pointer(&bss_path),
+        };
+        c_list_link_tail(&priv->bss_lst_head, &bss_info->_bss_lst);
+        g_hash_table_add(priv->bss_idx, bss_info);
+
+        _bss_info_properties_changed(self, bss_info, properties, TRUE);
+        return;
+    }
+
     bss_info  = g_slice_new(NMSupplicantBssInfo);
     *bss_info = (NMSupplicantBssInfo){
         ._self             = self,
@@ -1907,7 +1923,7 @@ _properties_changed_main(NMSupplicantInterface *self, GVariant *properties)
             bss_info->_bss_dirty = TRUE;
 
         for (iter = v_strv; *iter; iter++)
-            _bss_info_add(self, *iter);
+            _bss_info_add(self, *iter, NULL);
 
         g_free(v_strv);
 
@@ -2885,11 +2901,13 @@ _signal_handle(NMSupplicantInterface *self,
             return;
 
         if (nm_streq(signal_name, "BSSAdded")) {
+            gs_unref_variant GVariant *bss_properties = NULL;
+
             if (!g_variant_is_of_type(parameters, G_VARIANT_TYPE("(oa{sv})")))
                 return;
 
-            g_variant_get(parameters, "(&oa{sv})", &path, NULL);
-            _bss_info_add(self, path);
+            g_variant_get(parameters, "(&o@a{sv})", &path, &bss_properties);
+            _bss_info_add(self, path, bss_properties);
             return;
         }
 
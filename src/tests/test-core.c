@@ -1180,35 +1180,115 @@ test_connection_sort_autoconnect_priority(void)
     _test_connection_sort_autoconnect_priority_free(c2);
 }
 
+static NMConnection *
+_create_connection_slave(const char *id,
+                         const char *uuid,
+                         const char *interface_name,
+                         const char *master)
+{
+    NMConnection *       c;
+    NMSettingConnection *s_con;
+
+    c = nmtst_create_minimal_connection(id, uuid, NM_SETTING_WIRED_SETTING_NAME, &s_con);
+    g_object_set(s_con,
+                 NM_SETTING_CONNECTION_INTERFACE_NAME,
+                 interface_name,
+                 NM_SETTING_CONNECTION_MASTER,
+                 master,
+                 NULL);
+    return c;
+}
+
+static void
+test_connections_activation_order(void)
+{
+#define UUID_BOND "8f3c2e7a-6a8c-4f4e-9d7a-1b3a2c4d5e6f"
+#define UUID_C1   "0a1b2c3d-4e5f-4a6b-8c7d-8e9fa0b1c2d3"
+#define UUID_C2   "1b2c3d4e-5f6a-4b7c-9d8e-9fa0b1c2d3e4"
+    NMConnection *connections[] = {
+        _create_connection_slave("slave-of-bond", NULL, NULL, UUID_BOND),
+        _create_connection_slave("plain", NULL, NULL, NULL),
+        _create_connection_slave("slave-of-br0", NULL, NULL, "br0"),
+        _create_connection_slave("bond", UUID_BOND, "bond0", "br0"),
+        _create_connection_slave("bridge", NULL, "br0", NULL),
+        _create_connection_slave("slave-of-missing", NULL, NULL, "missing0"),
+        _create_connection_slave("cycle-1", UUID_C1, NULL, UUID_C2),
+        _create_connection_slave("cycle-2", UUID_C2, NULL, UUID_C1),
+    };
+    /* masters first, and the order of the request otherwise. A cycle
+     * is left as is. */
+    const guint    expected[] = {1, 4, 5, 6, 7, 2, 3, 0};
+    gs_free guint *order      = NULL;
+    guint          i;
+
+    G_STATIC_ASSERT(G_N_ELEMENTS(connections) == G_N_ELEMENTS(expected));
+
+    order = nm_utils_connections_activation_order(connections, G_N_ELEMENTS(connections));
+    g_assert_cmpmem(order,
+                    G_N_ELEMENTS(connections) * sizeof(guint),
+                    expected,
+                    sizeof(expected));
+
+    /* if no master is in the list, the order does not change. */
+    nm_clear_g_free(&order);
+    order = nm_utils_connections_activation_order(&connections[4], 2);
+    g_assert_cmpint(order[0], ==, 0);
+    g_assert_cmpint(order[1], ==, 1);
+
+    for (i = 0; i < G_N_ELEMENTS(connections); i++)
+        g_object_unref(connections[i]);
+}
+
+
 /*****************************************************************************/
 
 #define MATCH_S390   "S390:"
 #define MATCH_DRIVER "DRIVER:"
+#define MATCH_HWADDR "HWADDR:"
 
 static NMMatchSpecMatchType
 _test_match_spec_device(const GSList *specs, const char *match_str)
 {
+    gs_free char *        s    = NULL;
+    NMMatchSpecDeviceData data = {};
+    NMMatchSpecDevice *   compiled;
+    NMMatchSpecMatchType  m;
+    NMMatchSpecMatchType  m_compiled;
+
     if (match_str && g_str_has_prefix(match_str, MATCH_S390))
-        return nm_match_spec_device(specs,
-                                    NULL,
-                                    NULL,
-                                    NULL,
-                                    NULL,
-                                    NULL,
-                                    &match_str[NM_STRLEN(MATCH_S390)],
-                                    NULL);
-    if (match_str && g_str_has_prefix(match_str, MATCH_DRIVER)) {
-        gs_free char *s = g_strdup(&match_str[NM_STRLEN(MATCH_DRIVER)]);
-        char *        t;
+        data.s390_subchannels = &match_str[NM_STRLEN(MATCH_S390)];
+    else if (match_str && g_str_has_prefix(match_str, MATCH_DRIVER)) {
+        char *t;
 
+        s = g_strdup(&match_str[NM_STRLEN(MATCH_DRIVER)]);
         t = strchr(s, '|');
         if (t) {
             t[0] = '\0';
             t++;
         }
-        return nm_match_spec_device(specs, NULL, NULL, s, t, NULL, NULL, NULL);
-    }
-    return nm_match_spec_device(specs, match_str, NULL, NULL, NULL, NULL, NULL, NULL);
+        data.driver         = s;
+        data.driver_version = t;
+    } else if (match_str && g_str_has_prefix(match_str, MATCH_HWADDR))
+        data.hwaddr = &match_str[NM_STRLEN(MATCH_HWADDR)];
+    else
+        data.interface_name = match_str;
+
+    m = nm_match_spec_device(specs,
+                             data.interface_name,
+                             data.device_type,
+                             data.driver,
+                             data.driver_version,
+                             data.hwaddr,
+                             data.s390_subchannels,
+                             data.dhcp_plugin);
+
+    /* the compiled matcher must always agree. */
+    compiled   = nm_match_spec_device_new(specs);
+    m_compiled = nm_match_spec_device_match(compiled, &data);
+    nm_match_spec_device_free(compiled);
+    g_assert_cmpint(m, ==, m_compiled);
+
+    return m;
 }
 
 static void
@@ -1384,6 +1464,40 @@ test_match_spec_device(void)
                                             MATCH_S390 "0.0.1000,0.0.1001",
                                             MATCH_S390 "0.0.1000,0.0.1002"));
 
+    _do_test_match_spec_device("mac:aa:bb:cc:dd:ee:ff",
+                               NM_MAKE_STRV(MATCH_HWADDR "aa:bb:cc:dd:ee:ff",
+                                            MATCH_HWADDR "AA:BB:CC:DD:EE:FF"),
+                               NM_MAKE_STRV(MATCH_HWADDR "aa:bb:cc:dd:ee:00",
+                                            MATCH_HWADDR "aa:bb:cc:dd",
+                                            "aa:bb:cc:dd:ee:ff"),
+                               NULL);
+    _do_test_match_spec_device("*,except:mac:aa:bb:cc:dd:ee:ff",
+                               NM_MAKE_STRV(MATCH_HWADDR "aa:bb:cc:dd:ee:00", "aa:bb:cc:dd:ee:ff"),
+                               NM_MAKE_STRV(NULL),
+                               NM_MAKE_STRV(MATCH_HWADDR "AA:BB:CC:DD:EE:FF"));
+
+    /* a spec without prefix matches either the MAC address or the interface name. */
+    _do_test_match_spec_device("aa:bb:cc:dd:ee:ff",
+                               NM_MAKE_STRV(MATCH_HWADDR "AA:BB:CC:DD:EE:FF", "aa:bb:cc:dd:ee:ff"),
+                               NM_MAKE_STRV(MATCH_HWADDR "aa:bb:cc:dd:ee:00", "AA:BB:CC:DD:EE:FF"),
+                               NULL);
+
+    /* InfiniBand addresses only compare the last 8 bytes. */
+#define IB_ADDR_1 "80:00:02:08:fe:80:00:00:00:00:00:00:00:02:c9:03:00:00:0f:65"
+#define IB_ADDR_2 "80:00:00:48:fe:80:00:00:00:00:00:00:00:02:c9:03:00:00:0f:65"
+#define IB_ADDR_3 "80:00:02:08:fe:80:00:00:00:00:00:00:00:02:c9:03:00:00:0f:66"
+    _do_test_match_spec_device("mac:" IB_ADDR_1,
+                               NM_MAKE_STRV(MATCH_HWADDR IB_ADDR_1, MATCH_HWADDR IB_ADDR_2),
+                               NM_MAKE_STRV(MATCH_HWADDR IB_ADDR_3, MATCH_HWADDR "aa:bb:cc:dd:ee:ff"),
+                               NULL);
+    _do_test_match_spec_device(IB_ADDR_1,
+                               NM_MAKE_STRV(MATCH_HWADDR IB_ADDR_1, MATCH_HWADDR IB_ADDR_2, IB_ADDR_1),
+                               NM_MAKE_STRV(MATCH_HWADDR IB_ADDR_3, IB_ADDR_2),
+                               NULL);
+#undef IB_ADDR_1
+#undef IB_ADDR_2
+#undef IB_ADDR_3
+
     _do_test_match_spec_device("driver:DRV",
                                NM_MAKE_STRV(MATCH_DRIVER "DRV", MATCH_DRIVER "DRV|1.6"),
                                NM_MAKE_STRV(MATCH_DRIVER "DR", MATCH_DRIVER "DR*"),
@@ -2528,6 +2642,101 @@ test_connectivity_state_cmp(void)
 
 /*****************************************************************************/
 
+typedef struct {
+    GArray *order;
+} IdleClassTestData;
+
+static gboolean
+_idle_class_link_changed_cb(gpointer user_data)
+{
+    IdleClassTestData *data = user_data;
+    NMIdleClass        c    = NM_IDLE_CLASS_LINK_CHANGED;
+
+    g_array_append_val(data->order, c);
+    return G_SOURCE_REMOVE;
+}
+
+static gboolean
+_idle_class_activation_stage_cb(gpointer user_data)
+{
+    IdleClassTestData *data = user_data;
+    NMIdleClass        c    = NM_IDLE_CLASS_ACTIVATION_STAGE;
+
+    g_array_append_val(data->order, c);
+    return G_SOURCE_REMOVE;
+}
+
+static gboolean
+_idle_class_ip_config_cb(gpointer user_data)
+{
+    IdleClassTestData *data = user_data;
+    NMIdleClass        c    = NM_IDLE_CLASS_IP_CONFIG;
+
+    g_array_append_val(data->order, c);
+    return G_SOURCE_REMOVE;
+}
+
+static void
+test_idle_class(void)
+{
+    IdleClassTestData data = {
+        .order = g_array_new(FALSE, FALSE, sizeof(NMIdleClass)),
+    };
+    NMIdleClassStats stats_before[_NM_IDLE_CLASS_NUM];
+    guint            id_removed;
+    guint            i;
+
+    for (i = 0; i < _NM_IDLE_CLASS_NUM; i++)
+        stats_before[i] = *nm_idle_class_get_stats(i);
+
+    /* schedule in reverse order of priority, plus one source that never runs. */
+    nm_idle_class_add(NM_IDLE_CLASS_IP_CONFIG, _idle_class_ip_config_cb, &data);
+    nm_idle_class_add(NM_IDLE_CLASS_IP_CONFIG, _idle_class_ip_config_cb, &data);
+    id_removed = nm_idle_class_add(NM_IDLE_CLASS_IP_CONFIG, _idle_class_ip_config_cb, &data);
+    nm_idle_class_add(NM_IDLE_CLASS_ACTIVATION_STAGE, _idle_class_activation_stage_cb, &data);
+    nm_idle_class_add(NM_IDLE_CLASS_LINK_CHANGED, _idle_class_link_changed_cb, &data);
+
+    g_assert_cmpint(nm_idle_class_get_stats(NM_IDLE_CLASS_IP_CONFIG)->n_pending,
+                    ==,
+                    stats_before[NM_IDLE_CLASS_IP_CONFIG].n_pending + 3);
+    g_assert_cmpint(nm_idle_class_get_stats(NM_IDLE_CLASS_ACTIVATION_STAGE)->n_pending,
+                    ==,
+                    stats_before[NM_IDLE_CLASS_ACTIVATION_STAGE].n_pending + 1);
+    g_assert_cmpint(nm_idle_class_get_stats(NM_IDLE_CLASS_LINK_CHANGED)->n_pending,
+                    ==,
+                    stats_before[NM_IDLE_CLASS_LINK_CHANGED].n_pending + 1);
+
+    g_assert(nm_clear_g_source(&id_removed));
+    g_assert_cmpint(nm_idle_class_get_stats(NM_IDLE_CLASS_IP_CONFIG)->n_pending,
+                    ==,
+                    stats_before[NM_IDLE_CLASS_IP_CONFIG].n_pending + 2);
+
+    while (g_main_context_iteration(NULL, FALSE)) {}
+
+    /* the classes run in order of their priority. */
+    g_assert_cmpint(data.order->len, ==, 4);
+    g_assert_cmpint(g_array_index(data.order, NMIdleClass, 0), ==, NM_IDLE_CLASS_LINK_CHANGED);
+    g_assert_cmpint(g_array_index(data.order, NMIdleClass, 1), ==, NM_IDLE_CLASS_ACTIVATION_STAGE);
+    g_assert_cmpint(g_array_index(data.order, NMIdleClass, 2), ==, NM_IDLE_CLASS_IP_CONFIG);
+    g_assert_cmpint(g_array_index(data.order, NMIdleClass, 3), ==, NM_IDLE_CLASS_IP_CONFIG);
+
+    for (i = 0; i < _NM_IDLE_CLASS_NUM; i++) {
+        const NMIdleClassStats *stats = nm_idle_class_get_stats(i);
+
+        g_assert_cmpint(stats->n_pending, ==, stats_before[i].n_pending);
+        g_assert_cmpint(stats->n_dispatched,
+                        ==,
+                        stats_before[i].n_dispatched + (i == NM_IDLE_CLASS_IP_CONFIG ? 2 : 1));
+        g_assert_cmpint(stats->wait_total_nsec, >=, stats_before[i].wait_total_nsec);
+        g_assert_cmpint(stats->wait_max_nsec, <=, stats->wait_total_nsec);
+        g_assert(nm_idle_class_to_string(i));
+    }
+
+    g_array_unref(data.order);
+}
+
+/*****************************************************************************/
+
 NMTST_DEFINE();
 
 int
@@ -2572,6 +2781,8 @@ main(int argc, char **argv)
 
     g_test_add_func("/general/connection-sort/autoconnect-priority",
                     test_connection_sort_autoconnect_priority);
+    g_test_add_func("/general/connection-sort/activation-order",
+                    test_connections_activation_order);
 
     g_test_add_func("/general/match-spec/device", test_match_spec_device);
     g_test_add_func("/general/match-spec/config", test_match_spec_config);
@@ -2599,6 +2810,7 @@ main(int argc, char **argv)
     g_test_add_func("/core/general/test_connectivity_state_cmp", test_connectivity_state_cmp);
     g_test_add_func("/core/general/test_kernel_cmdline_match_check",
                     test_kernel_cmdline_match_check);
+    g_test_add_func("/core/general/idle-class", test_idle_class);
 
     return g_test_run();
 }
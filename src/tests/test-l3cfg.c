@@ -494,6 +494,102 @@ test_l3cfg(gconstpointer test_data)
 
 /*****************************************************************************/
 
+static void
+_test_l3cfg_commit_assert(NML3Cfg *         l3cfg,
+                          NML3CfgCommitType commit_type,
+                          gboolean          expect_elided)
+{
+    guint commit_count;
+    guint elided_count;
+    guint commit_count_after;
+    guint elided_count_after;
+
+    nm_l3cfg_get_commit_stats(l3cfg, &commit_count, &elided_count);
+    nm_l3cfg_commit(l3cfg, commit_type);
+    nm_l3cfg_get_commit_stats(l3cfg, &commit_count_after, &elided_count_after);
+
+    g_assert_cmpint(commit_count_after, ==, commit_count + 1);
+    g_assert_cmpint(elided_count_after, ==, elided_count + (expect_elided ? 1 : 0));
+}
+
+static void
+test_l3cfg_commit_elide(void)
+{
+    nm_auto(_test_fixture_1_teardown) TestFixture1 test_fixture = {};
+    const TestFixture1 *                           f;
+    gs_unref_object NML3Cfg *l3cfg0                       = NULL;
+    nm_auto_unref_l3cd_init NML3ConfigData *l3cd          = NULL;
+    const in_addr_t                         addr          = nmtst_inet4_from_string("192.168.133.45");
+    NML3CfgCommitTypeHandle *               commit_type_1 = NULL;
+
+    f = _test_fixture_1_setup(&test_fixture, 5);
+
+    l3cfg0 = _netns_access_l3cfg(f->netns, f->ifindex0);
+
+    commit_type_1 = nm_l3cfg_commit_type_register(l3cfg0, NM_L3_CFG_COMMIT_TYPE_UPDATE, NULL);
+
+    l3cd = nm_l3_config_data_new(f->multiidx, f->ifindex0);
+    nm_l3_config_data_add_address_4(l3cd,
+                                    NM_PLATFORM_IP4_ADDRESS_INIT(.address      = addr,
+                                                                 .peer_address = addr,
+                                                                 .plen         = 24, ));
+    nm_l3_config_data_seal(l3cd);
+
+    nm_l3cfg_add_config(l3cfg0,
+                        GINT_TO_POINTER('a'),
+                        FALSE,
+                        l3cd,
+                        'a',
+                        0,
+                        0,
+                        NM_PLATFORM_ROUTE_METRIC_DEFAULT_IP4,
+                        NM_PLATFORM_ROUTE_METRIC_DEFAULT_IP6,
+                        0,
+                        0,
+                        NM_L3_ACD_DEFEND_TYPE_NEVER,
+                        0,
+                        NM_L3_CONFIG_MERGE_FLAGS_NONE);
+
+    /* the first commit always syncs. */
+    _test_l3cfg_commit_assert(l3cfg0, NM_L3_CFG_COMMIT_TYPE_UPDATE, FALSE);
+    nmtstp_platform_ip_addresses_assert(f->platform,
+                                        f->ifindex0,
+                                        TRUE,
+                                        FALSE,
+                                        FALSE,
+                                        "192.168.133.45");
+
+    /* neither the configuration nor platform changed. The commit is elided. */
+    _test_l3cfg_commit_assert(l3cfg0, NM_L3_CFG_COMMIT_TYPE_UPDATE, TRUE);
+    _test_l3cfg_commit_assert(l3cfg0, NM_L3_CFG_COMMIT_TYPE_UPDATE, TRUE);
+
+    /* somebody removes the address. That is a platform change, and the next
+     * commit must sync again. */
+    nmtstp_ip4_address_del(f->platform, -1, f->ifindex0, addr, 24, addr);
+    _test_l3cfg_commit_assert(l3cfg0, NM_L3_CFG_COMMIT_TYPE_UPDATE, FALSE);
+    _test_l3cfg_commit_assert(l3cfg0, NM_L3_CFG_COMMIT_TYPE_UPDATE, TRUE);
+
+    /* a different commit type also syncs. */
+    _test_l3cfg_commit_assert(l3cfg0, NM_L3_CFG_COMMIT_TYPE_ASSUME, FALSE);
+    _test_l3cfg_commit_assert(l3cfg0, NM_L3_CFG_COMMIT_TYPE_ASSUME, TRUE);
+    _test_l3cfg_commit_assert(l3cfg0, NM_L3_CFG_COMMIT_TYPE_UPDATE, FALSE);
+
+    /* REAPPLY is never elided. It also restores the removed address. */
+    _test_l3cfg_commit_assert(l3cfg0, NM_L3_CFG_COMMIT_TYPE_REAPPLY, FALSE);
+    _test_l3cfg_commit_assert(l3cfg0, NM_L3_CFG_COMMIT_TYPE_REAPPLY, FALSE);
+    nmtstp_platform_ip_addresses_assert(f->platform,
+                                        f->ifindex0,
+                                        TRUE,
+                                        FALSE,
+                                        FALSE,
+                                        "192.168.133.45");
+
+    nm_l3cfg_remove_config_all(l3cfg0, GINT_TO_POINTER('a'), FALSE);
+    nm_l3cfg_commit_type_unregister(l3cfg0, commit_type_1);
+}
+
+/*****************************************************************************/
+
 #define L3IPV4LL_ACD_TIMEOUT_MSEC 1500u
 
 typedef struct {
@@ -790,6 +886,7 @@ _nmtstp_setup_tests(void)
     g_test_add_data_func("/l3cfg/2", GINT_TO_POINTER(2), test_l3cfg);
     g_test_add_data_func("/l3cfg/3", GINT_TO_POINTER(3), test_l3cfg);
     g_test_add_data_func("/l3cfg/4", GINT_TO_POINTER(4), test_l3cfg);
+    g_test_add_func("/l3cfg/commit-elide", test_l3cfg_commit_elide);
     g_test_add_data_func("/l3-ipv4ll/1", GINT_TO_POINTER(1), test_l3_ipv4ll);
     g_test_add_data_func("/l3-ipv4ll/2", GINT_TO_POINTER(2), test_l3_ipv4ll);
 }